@@ -0,0 +1,100 @@
+/*
+ * chained hash table - reference separate-chaining hash table for benchmarks
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * This is the original chained engine of hashTable (fixed bucket count, one
+ * malloc'd node per key, DJB2 modulo capacity). It is kept only so the
+ * benchmarks can compare the open-addressing table against it.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "chainedHashTable.h"
+
+static unsigned long hash_djb2(const char *str) {
+    unsigned long hash = 5381;
+    int c;
+
+    while ((c = *str++))
+    {
+        hash = ((hash << 5) + hash) + c;
+    }
+
+    return hash;
+}
+
+chainedHashTable* chainedHashTable_create(size_t capacity) {
+    chainedHashTable* ht = malloc(sizeof(chainedHashTable));
+    if (ht == NULL) {
+        return NULL;
+    }
+
+    ht->capacity = capacity;
+    ht->length = 0;
+    ht->entries = (chained_entry**)calloc(capacity, sizeof(chained_entry*));
+    if (ht->entries == NULL) {
+        free(ht);
+        return NULL;
+    }
+    return ht;
+}
+
+void chainedHashTable_destroy(chainedHashTable* ht) {
+    if (ht == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < ht->capacity; i++) {
+        chained_entry* entry = ht->entries[i];
+        while (entry != NULL) {
+            chained_entry* next = entry->next;
+            free((void*)entry->key);
+            free(entry->value);
+            free(entry);
+            entry = next;
+        }
+    }
+    free(ht->entries);
+    free(ht);
+}
+
+void* chainedHashTable_incrementOrInsert(chainedHashTable* ht, const char* key) {
+    size_t index = hash_djb2(key) % ht->capacity;
+
+    for (chained_entry* entry = ht->entries[index]; entry != NULL; entry = entry->next) {
+        if (strcmp(key, entry->key) == 0) {
+            (*(int*)entry->value)++;
+            return entry->value;
+        }
+    }
+
+    chained_entry* newEntry = malloc(sizeof(chained_entry));
+    int* initialValue = malloc(sizeof(int));
+    char* keyCopy = strdup(key);
+    if (newEntry == NULL || initialValue == NULL || keyCopy == NULL) {
+        free(newEntry);
+        free(initialValue);
+        free(keyCopy);
+        return NULL;
+    }
+    *initialValue = 1;
+    newEntry->key = keyCopy;
+    newEntry->value = initialValue;
+    newEntry->next = ht->entries[index];
+    ht->entries[index] = newEntry;
+    ht->length++;
+    return newEntry->value;
+}
+
+void* chainedHashTable_lookup(chainedHashTable* ht, const char* key) {
+    size_t index = hash_djb2(key) % ht->capacity;
+
+    for (chained_entry* entry = ht->entries[index]; entry != NULL; entry = entry->next) {
+        if (strcmp(key, entry->key) == 0) {
+            return entry->value;
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,55 @@
+/*
+ * chained hash table - reference separate-chaining hash table for benchmarks
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef CHAINED_HASHTABLE_H
+#define CHAINED_HASHTABLE_H
+
+#include <stddef.h>
+
+// Chain node - one separately allocated node per key
+typedef struct chained_entry {
+    const char* key;                // duplicated key string
+    void* value;                    // pointer to the value data
+    struct chained_entry* next;     // next node in the same bucket
+} chained_entry;
+
+// Fixed-size bucket array, never resized
+typedef struct {
+    chained_entry** entries;        // bucket heads
+    size_t capacity;                // number of buckets
+    size_t length;                  // number of keys stored
+} chainedHashTable;
+
+/**
+ * Creates a chained hash table with a fixed number of buckets
+ * @param capacity Number of buckets to allocate
+ * @return Pointer to the new table, NULL on allocation failure
+ */
+chainedHashTable* chainedHashTable_create(size_t capacity);
+
+/**
+ * Frees the table, every key and every value
+ * @param ht Table to destroy, can be NULL
+ */
+void chainedHashTable_destroy(chainedHashTable* ht);
+
+/**
+ * Increments the int counter of a key, inserting it with count 1 if missing
+ * @param ht Table to update
+ * @param key Null-terminated key string
+ * @return Pointer to the int counter, NULL on allocation failure
+ */
+void* chainedHashTable_incrementOrInsert(chainedHashTable* ht, const char* key);
+
+/**
+ * Looks up the value of a key
+ * @param ht Table to search
+ * @param key Null-terminated key string
+ * @return Pointer to the value, NULL if the key is not present
+ */
+void* chainedHashTable_lookup(chainedHashTable* ht, const char* key);
+
+#endif // CHAINED_HASHTABLE_H
@@ -0,0 +1,245 @@
+/*
+ * concurrent hash table benchmark - one shared table vs. private tables under contention
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: concurrentHashTableBench [text file] [max threads] [passes]
+ *
+ * The cleaned words of the text file are counted [passes] times by 1, 2, 4
+ * ... up to [max threads] threads, each thread taking an equal slice of the
+ * word stream. Natural text is Zipfian, a few words make up most of the
+ * stream, so the threads keep hitting the same counters; corpusGen -z makes
+ * the skew stronger or weaker. Three ways of sharing the work are timed:
+ *   - shared:  one concurrentHashTable, created small so it is resized
+ *              cooperatively while the threads count
+ *   - sharded: a private hashTable per thread, merged into one afterwards
+ *              (the merge is timed), as find_frequent_words_ex() does
+ *   - locked:  one hashTable behind a mutex taken for every word
+ * The shared table is checked against a serial count after every run, every
+ * word must have the same count. Any mismatch fails the benchmark.
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "concurrentHashTable.h"
+#include "hashTable.h"
+#include "stats.h"
+#include "wordList.h"
+
+typedef enum {
+    MODE_SHARED = 0,
+    MODE_SHARDED,
+    MODE_LOCKED,
+    MODE_COUNT
+} benchMode;
+
+// Work of one counting thread
+typedef struct {
+    const wordList *list;
+    size_t begin;               // first word of the slice
+    size_t end;                 // one past the last word
+    size_t passes;              // times the slice is counted
+    benchMode mode;
+    concurrentHashTable *shared; // MODE_SHARED
+    hashTable *table;           // MODE_SHARDED: private, MODE_LOCKED: common
+    pthread_mutex_t *lock;      // MODE_LOCKED
+    bool ok;
+} benchWorker;
+
+static const char *const modeNames[MODE_COUNT] = { "shared", "sharded", "locked" };
+
+static hashTable *createCounts(void) {
+    hashTable_config config = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, false };
+    return hashTable_create(&config);
+}
+
+static void *countSlice(void *arg) {
+    benchWorker *worker = (benchWorker *)arg;
+    const wordList *list = worker->list;
+    bool ok = true;
+    for (size_t pass = 0; ok && pass < worker->passes; pass++) {
+        for (size_t i = worker->begin; ok && i < worker->end; i++) {
+            const char *word = list->bytes + list->offsets[i];
+            size_t length = list->offsets[i + 1] - list->offsets[i];
+            switch (worker->mode) {
+                case MODE_SHARED:
+                    ok = concurrentHashTable_incrementOrInsertLen(worker->shared, word, length);
+                    break;
+                case MODE_SHARDED:
+                    ok = hashTable_incrementOrInsertLen(worker->table, word, length) != NULL;
+                    break;
+                default:
+                    pthread_mutex_lock(worker->lock);
+                    ok = hashTable_incrementOrInsertLen(worker->table, word, length) != NULL;
+                    pthread_mutex_unlock(worker->lock);
+                    break;
+            }
+        }
+    }
+    worker->ok = ok;
+    return NULL;
+}
+
+static bool mergeInto(hashTable *dst, hashTable *src) {
+    hashTable_iterator iter;
+    hashTable_initIterator(src, &iter);
+    const char *word;
+    void *value;
+    while (hashTable_iteratorNext(&iter, &word, &value)) {
+        size_t length = hashTable_valueEntry(src, value)->length;
+        if (hashTable_addCountLen(dst, word, length, *(const uint64_t *)value) == NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Every word of the shared table has its serial count, and no word is missing
+static bool checkShared(concurrentHashTable *shared, hashTable *exact, size_t passes) {
+    if (concurrentHashTable_getLength(shared) != hashTable_getLength(exact)) {
+        printf("Shared table holds %zu words, serial count %zu\n", concurrentHashTable_getLength(shared),
+               hashTable_getLength(exact));
+        return false;
+    }
+    concurrentHashTable_iterator iter;
+    concurrentHashTable_initIterator(shared, &iter);
+    const char *word;
+    uint64_t count;
+    while (concurrentHashTable_iteratorNext(&iter, &word, &count)) {
+        const uint64_t *expected = (const uint64_t *)hashTable_lookup(exact, word);
+        if (expected == NULL || *expected * passes != count) {
+            printf("Word '%s': shared %llu, serial %llu\n", word, (unsigned long long)count,
+                   (unsigned long long)(expected != NULL ? *expected * passes : 0));
+            return false;
+        }
+    }
+    return true;
+}
+
+// Count the words with threadCount threads, returns the elapsed time or a negative value on failure
+static double runMode(benchMode mode, const wordList *list, size_t threadCount, size_t passes, hashTable *exact,
+                      uint64_t *resizes) {
+    benchWorker *workers = (benchWorker *)calloc(threadCount, sizeof(benchWorker));
+    pthread_t *threads = (pthread_t *)calloc(threadCount, sizeof(pthread_t));
+    bool *started = (bool *)calloc(threadCount, sizeof(bool));
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    concurrentHashTable *shared = NULL;
+    hashTable *common = NULL;
+    bool ok = workers != NULL && threads != NULL && started != NULL;
+
+    if (ok && mode == MODE_SHARED) {
+        shared = concurrentHashTable_create(NULL);
+        ok = shared != NULL;
+    } else if (ok && mode == MODE_LOCKED) {
+        common = createCounts();
+        ok = common != NULL;
+    }
+    for (size_t t = 0; ok && t < threadCount; t++) {
+        workers[t].list = list;
+        workers[t].begin = list->count / threadCount * t;
+        workers[t].end = (t + 1 == threadCount) ? list->count : list->count / threadCount * (t + 1);
+        workers[t].passes = passes;
+        workers[t].mode = mode;
+        workers[t].shared = shared;
+        workers[t].table = (mode == MODE_SHARDED) ? createCounts() : common;
+        workers[t].lock = &lock;
+        ok = workers[t].table != NULL || mode == MODE_SHARED;
+    }
+
+    double start = stats_now();
+    for (size_t t = 1; ok && t < threadCount; t++) {
+        started[t] = (pthread_create(&threads[t], NULL, countSlice, &workers[t]) == 0);
+        if (!started[t]) {
+            countSlice(&workers[t]); // Could not start a thread, count inline
+        }
+    }
+    if (ok) {
+        countSlice(&workers[0]);
+    }
+    for (size_t t = 1; t < threadCount; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+    for (size_t t = 0; ok && t < threadCount; t++) {
+        ok = workers[t].ok;
+    }
+    for (size_t t = 1; ok && mode == MODE_SHARDED && t < threadCount; t++) {
+        ok = mergeInto(workers[0].table, workers[t].table);
+    }
+    double elapsed = stats_now() - start;
+
+    if (ok && mode == MODE_SHARED) {
+        *resizes = concurrentHashTable_getResizes(shared);
+        ok = checkShared(shared, exact, passes);
+    }
+    for (size_t t = 0; workers != NULL && mode == MODE_SHARDED && t < threadCount; t++) {
+        hashTable_destroy(workers[t].table);
+    }
+    concurrentHashTable_destroy(shared);
+    hashTable_destroy(common);
+    pthread_mutex_destroy(&lock);
+    free(workers);
+    free(threads);
+    free(started);
+    return ok ? elapsed : -1.0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t maxThreads = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 8;
+    size_t passes = (argc > 3) ? (size_t)strtoull(argv[3], NULL, 10) : 3;
+    wordList list = { 0 };
+
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+    if (passes == 0) {
+        passes = 1;
+    }
+    hashTable *exact = createCounts();
+    if (exact == NULL || !wordList_load(path, &list) || list.count == 0) {
+        printf("Error preparing benchmark input\n");
+        hashTable_destroy(exact);
+        wordList_free(&list);
+        return 1;
+    }
+    bool ok = true;
+    for (size_t i = 0; ok && i < list.count; i++) {
+        ok = hashTable_incrementOrInsertLen(exact, list.bytes + list.offsets[i],
+                                            list.offsets[i + 1] - list.offsets[i]) != NULL;
+    }
+
+    printf("%zu words, %zu distinct, %zu passes\n", list.count, hashTable_getLength(exact), passes);
+    printf("%-8s %8s %10s %10s %10s %8s\n", "mode", "threads", "seconds", "Mwords/s", "speedup", "resizes");
+    double single[MODE_COUNT] = { 0 };
+    for (size_t threads = 1; ok && threads <= maxThreads; threads *= 2) {
+        for (int mode = 0; ok && mode < MODE_COUNT; mode++) {
+            uint64_t resizes = 0;
+            double elapsed = runMode((benchMode)mode, &list, threads, passes, exact, &resizes);
+            if (elapsed < 0.0) {
+                ok = false;
+                break;
+            }
+            if (threads == 1) {
+                single[mode] = elapsed;
+            }
+            printf("%-8s %8zu %10.3f %10.2f %10.2f %8llu\n", modeNames[mode], threads, elapsed,
+                   (double)(list.count * passes) / elapsed / 1e6, single[mode] / elapsed,
+                   (unsigned long long)resizes);
+        }
+    }
+    if (!ok) {
+        printf("FAILED\n");
+    }
+
+    hashTable_destroy(exact);
+    wordList_free(&list);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+/*
+ * corpus generator - synthetic Zipfian text for the benchmarks
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: corpusGen [-s size] [-v vocabulary] [-z exponent] [-l mean length]
+ *                  [-p punctuation rate] [-r seed] [-o output]
+ *
+ *   -s  bytes to write, with an optional K, M or G suffix (default 100M)
+ *   -v  number of distinct words (default 100000)
+ *   -z  Zipf exponent of the word frequencies (default 1.0)
+ *   -l  mean word length, lengths are geometric around it and the most
+ *       frequent words get the shortest ones, as in natural text (default 7)
+ *   -p  fraction of words capitalized and followed by punctuation, which
+ *       exercises the cleaning path (default 0.05)
+ *   -r  random seed, equal seeds give identical corpora (default 1)
+ *   -o  output file (default stdout)
+ *
+ * Words are written twelve to a line. The output is deterministic for a given
+ * set of options, so corpora can be regenerated instead of stored.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Longest generated word, rank digits included
+#define CORPUS_MAX_WORD_LENGTH (40)
+// Bytes buffered before each fwrite
+#define CORPUS_OUTPUT_BUFFER (1024 * 1024)
+
+typedef struct {
+    uint64_t size;              // bytes to write
+    size_t vocabulary;          // distinct words
+    double exponent;            // Zipf exponent
+    double meanLength;          // mean word length
+    double punctuationRate;     // fraction of decorated words
+    uint64_t seed;              // random seed
+    const char *output;         // output path, NULL for stdout
+} corpusOptions;
+
+typedef struct {
+    char *bytes;                // every word, back to back
+    size_t *offsets;            // start of word i in bytes, vocabulary + 1 entries
+    double *cdf;                // cumulative Zipf probability of ranks 0..i
+} vocabulary;
+
+static uint64_t rngState;
+
+// xorshift64*, fast and good enough for sampling
+static uint64_t nextRandom(void) {
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return rngState * UINT64_C(2685821657736338717);
+}
+
+// Uniform in [0, 1)
+static double nextUniform(void) {
+    return (double)(nextRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static bool parseSize(const char *text, uint64_t *size) {
+    char *end;
+    double value = strtod(text, &end);
+    double scale = 1.0;
+    switch (*end) {
+        case 'k': case 'K': scale = 1024.0; end++; break;
+        case 'm': case 'M': scale = 1024.0 * 1024.0; end++; break;
+        case 'g': case 'G': scale = 1024.0 * 1024.0 * 1024.0; end++; break;
+        default: break;
+    }
+    if (end == text || *end != '\0' || value < 0) {
+        return false;
+    }
+    *size = (uint64_t)(value * scale);
+    return true;
+}
+
+static int cmpLength(const void *a, const void *b) {
+    return (int)*(const unsigned char *)a - (int)*(const unsigned char *)b;
+}
+
+// Words are distinct by construction: the rank in base 26 padded with random letters
+static bool buildVocabulary(const corpusOptions *options, vocabulary *vocab) {
+    size_t count = options->vocabulary;
+    unsigned char *lengths = malloc(count);
+    vocab->offsets = malloc((count + 1) * sizeof(size_t));
+    vocab->cdf = malloc(count * sizeof(double));
+    vocab->bytes = NULL;
+    if (lengths == NULL || vocab->offsets == NULL || vocab->cdf == NULL) {
+        free(lengths);
+        return false;
+    }
+
+    // Geometric lengths around the mean, shortest first so frequent words are short
+    double stop = 1.0 / (options->meanLength > 1.0 ? options->meanLength : 1.0);
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t length = 1;
+        while (length < CORPUS_MAX_WORD_LENGTH && nextUniform() >= stop) {
+            length++;
+        }
+        lengths[i] = (unsigned char)length;
+    }
+    qsort(lengths, count, 1, cmpLength);
+
+    for (size_t i = 0; i < count; i++) {
+        size_t digits = 1;
+        for (size_t rank = i; rank >= 26; rank /= 26) {
+            digits++;
+        }
+        if (lengths[i] < digits) {
+            lengths[i] = (unsigned char)digits;
+        }
+        vocab->offsets[i] = total;
+        total += lengths[i];
+    }
+    vocab->offsets[count] = total;
+
+    vocab->bytes = malloc(total);
+    if (vocab->bytes == NULL) {
+        free(lengths);
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        char *word = vocab->bytes + vocab->offsets[i];
+        size_t length = lengths[i];
+        size_t pos = 0;
+        for (size_t rank = i; ; rank /= 26) {
+            word[pos++] = (char)('a' + rank % 26);
+            if (rank < 26) {
+                break;
+            }
+        }
+        while (pos < length) {
+            word[pos++] = (char)('a' + nextRandom() % 26);
+        }
+    }
+    free(lengths);
+
+    // Zipf: P(rank i) is proportional to 1 / (i + 1)^exponent
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        sum += 1.0 / pow((double)(i + 1), options->exponent);
+        vocab->cdf[i] = sum;
+    }
+    for (size_t i = 0; i < count; i++) {
+        vocab->cdf[i] /= sum;
+    }
+    return true;
+}
+
+// Binary search of the cumulative distribution
+static size_t sampleRank(const vocabulary *vocab, size_t count) {
+    double u = nextUniform();
+    size_t low = 0;
+    size_t high = count - 1;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (vocab->cdf[mid] < u) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static bool writeCorpus(const corpusOptions *options, const vocabulary *vocab, FILE *out) {
+    static const char punctuation[] = ".,;:!?";
+    char *buffer = malloc(CORPUS_OUTPUT_BUFFER + 2 * CORPUS_MAX_WORD_LENGTH);
+    size_t used = 0;
+    uint64_t written = 0;
+    unsigned int column = 0;
+    if (buffer == NULL) {
+        return false;
+    }
+
+    while (written + used < options->size) {
+        size_t rank = sampleRank(vocab, options->vocabulary);
+        const char *word = vocab->bytes + vocab->offsets[rank];
+        size_t length = vocab->offsets[rank + 1] - vocab->offsets[rank];
+        bool decorate = nextUniform() < options->punctuationRate;
+
+        memcpy(buffer + used, word, length);
+        if (decorate) {
+            buffer[used] = (char)(buffer[used] - 'a' + 'A');
+            buffer[used + length++] = punctuation[nextRandom() % (sizeof(punctuation) - 1)];
+        }
+        used += length;
+        buffer[used++] = (++column % 12 == 0) ? '\n' : ' ';
+
+        if (used >= CORPUS_OUTPUT_BUFFER) {
+            if (fwrite(buffer, 1, used, out) != used) {
+                free(buffer);
+                return false;
+            }
+            written += used;
+            used = 0;
+        }
+    }
+    bool ok = fwrite(buffer, 1, used, out) == used;
+    free(buffer);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    corpusOptions options = { 100ull * 1024 * 1024, 100000, 1.0, 7.0, 0.05, 1, NULL };
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        bool ok = hasValue;
+        if (ok && strcmp(argv[i], "-s") == 0) {
+            ok = parseSize(argv[++i], &options.size);
+        } else if (ok && strcmp(argv[i], "-v") == 0) {
+            options.vocabulary = (size_t)strtoull(argv[++i], NULL, 10);
+            ok = options.vocabulary > 0;
+        } else if (ok && strcmp(argv[i], "-z") == 0) {
+            options.exponent = strtod(argv[++i], NULL);
+        } else if (ok && strcmp(argv[i], "-l") == 0) {
+            options.meanLength = strtod(argv[++i], NULL);
+        } else if (ok && strcmp(argv[i], "-p") == 0) {
+            options.punctuationRate = strtod(argv[++i], NULL);
+        } else if (ok && strcmp(argv[i], "-r") == 0) {
+            options.seed = strtoull(argv[++i], NULL, 10);
+        } else if (ok && strcmp(argv[i], "-o") == 0) {
+            options.output = argv[++i];
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            fprintf(stderr, "Usage: corpusGen [-s size] [-v vocabulary] [-z exponent] [-l mean length] "
+                   "[-p punctuation rate] [-r seed] [-o output]\n");
+            return 1;
+        }
+    }
+
+    // A zero state would stay zero forever
+    rngState = options.seed * UINT64_C(0x9E3779B97F4A7C15) + 1;
+
+    vocabulary vocab;
+    if (!buildVocabulary(&options, &vocab)) {
+        fprintf(stderr, "Error building vocabulary\n");
+        free(vocab.bytes);
+        free(vocab.offsets);
+        free(vocab.cdf);
+        return 1;
+    }
+
+    FILE *out = (options.output != NULL) ? fopen(options.output, "wb") : stdout;
+    bool ok = out != NULL && writeCorpus(&options, &vocab, out);
+    if (out != NULL && out != stdout) {
+        ok = (fclose(out) == 0) && ok;
+    }
+    if (!ok) {
+        fprintf(stderr, "Error writing corpus\n");
+    }
+
+    free(vocab.bytes);
+    free(vocab.offsets);
+    free(vocab.cdf);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,250 @@
+/*
+ * hash function benchmark - DJB2, FNV-1a and wyhash on the counting workload
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: hashFunctionBench [text file] [distinct synthetic keys] [flood bits]
+ *
+ * Three key sets are hashed with every function:
+ *   - the cleaned word stream of a text file
+ *   - a synthetic vocabulary of unique keys "key0", "key1", ...
+ *   - a flood of 2^bits keys built from the blocks "Ez" and "FY", which all
+ *     share one DJB2 hash whatever the seed
+ * For each function the raw hashing speed, the throughput of an inline
+ * counter table built with it and its Robin Hood probe lengths are reported,
+ * together with the chain lengths the same hashes give when reduced with
+ * hash % buckets into as many buckets as distinct keys, as a chained table
+ * would (this exposes poorly mixed low bits).
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashFunctions.h"
+#include "hashTable.h"
+#include "stats.h"
+#include "wordScanner.h"
+
+// Passes over the key set when timing the bare hash function
+#define HASH_PASSES (5)
+
+typedef struct {
+    char *bytes;        // every key, back to back
+    size_t *offsets;    // start of key i, count + 1 entries
+    size_t count;       // number of keys
+    size_t bytesUsed;   // bytes of keys stored
+    size_t capacity;    // keys that fit in offsets
+    size_t bytesCapacity; // bytes that fit in bytes
+} keyList;
+
+typedef struct {
+    hashFunctions_algorithm algorithm;  // function to benchmark
+    bool randomSeed;                    // seed the table randomly
+} hashVariant;
+
+static const hashVariant variants[] = {
+    { HASH_FUNCTION_DJB2, false },
+    { HASH_FUNCTION_FNV1A, false },
+    { HASH_FUNCTION_WYHASH, false },
+    { HASH_FUNCTION_WYHASH, true },
+};
+
+static bool appendKey(const char *key, size_t length, void *context) {
+    keyList *list = (keyList *)context;
+    if (list->count + 1 >= list->capacity) {
+        size_t newCapacity = (list->capacity == 0) ? 4096 : list->capacity * 2;
+        size_t *grown = realloc(list->offsets, newCapacity * sizeof(size_t));
+        if (grown == NULL) {
+            return false;
+        }
+        list->offsets = grown;
+        list->capacity = newCapacity;
+    }
+    if (list->bytesUsed + length > list->bytesCapacity) {
+        size_t newCapacity = (list->bytesCapacity == 0) ? 65536 : list->bytesCapacity * 2;
+        while (newCapacity < list->bytesUsed + length) {
+            newCapacity *= 2;
+        }
+        char *grown = realloc(list->bytes, newCapacity);
+        if (grown == NULL) {
+            return false;
+        }
+        list->bytes = grown;
+        list->bytesCapacity = newCapacity;
+    }
+    memcpy(list->bytes + list->bytesUsed, key, length);
+    list->offsets[list->count++] = list->bytesUsed;
+    list->bytesUsed += length;
+    list->offsets[list->count] = list->bytesUsed;
+    return true;
+}
+
+static bool loadTextKeys(const char *path, keyList *list) {
+    FILE *fptr = fopen(path, "rb");
+    char buffer[65536];
+    size_t got;
+    if (fptr == NULL) {
+        printf("Error opening file %s\n", path);
+        return false;
+    }
+    wordScanner scanner;
+    wordScanner_init(&scanner, appendKey, list);
+    bool ok = true;
+    while (ok && (got = fread(buffer, 1, sizeof(buffer), fptr)) > 0) {
+        ok = wordScanner_feed(&scanner, buffer, got);
+    }
+    ok = ok && wordScanner_finish(&scanner);
+    wordScanner_destroy(&scanner);
+    fclose(fptr);
+    return ok;
+}
+
+static bool makeSyntheticKeys(size_t distinct, keyList *list) {
+    char key[32];
+    for (size_t i = 0; i < distinct; i++) {
+        int length = snprintf(key, sizeof(key), "key%zu", i);
+        if (!appendKey(key, (size_t)length, list)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// "Ez" and "FY" have equal DJB2 steps (69 * 33 + 122 == 70 * 33 + 89), so any
+// sequence of them collides with every other sequence of the same length
+static bool makeFloodKeys(unsigned int bits, keyList *list) {
+    char key[64];
+    for (size_t i = 0; i < ((size_t)1 << bits); i++) {
+        for (unsigned int b = 0; b < bits; b++) {
+            memcpy(key + 2 * b, ((i >> b) & 1u) ? "FY" : "Ez", 2);
+        }
+        if (!appendKey(key, 2 * (size_t)bits, list)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void freeKeys(keyList *list) {
+    free(list->bytes);
+    free(list->offsets);
+}
+
+// Bare hashing speed over every key, in millions of keys per second
+static double hashSpeed(hashFunctions_fn hash, const keyList *list, uint64_t *checksum) {
+    uint64_t sum = 0;
+    double start = stats_now();
+    for (int pass = 0; pass < HASH_PASSES; pass++) {
+        for (size_t i = 0; i < list->count; i++) {
+            sum += hash(list->bytes + list->offsets[i], list->offsets[i + 1] - list->offsets[i], 0);
+        }
+    }
+    double elapsed = stats_now() - start;
+    *checksum ^= sum; // keeps the loop from being optimized away
+    return (double)list->count * HASH_PASSES / elapsed / 1e6;
+}
+
+// Chain lengths of hash % distinct buckets, as seen by a lookup of every key
+static void chainStats(const hashTable *ht, double *mean, size_t *max) {
+    size_t buckets = (ht->length > 0) ? ht->length : 1;
+    uint32_t *chains = calloc(buckets, sizeof(uint32_t));
+    size_t total = 0;
+    *mean = 0.0;
+    *max = 0;
+    if (chains == NULL) {
+        return;
+    }
+
+    hashTable_iterator iter;
+    hashTable_initIterator((hashTable *)ht, &iter);
+    const char *key;
+    void *value;
+    while (hashTable_iteratorNext(&iter, &key, &value)) {
+        const ht_entry *entry = hashTable_valueEntry(ht, value);
+        uint32_t position = ++chains[entry->hash % buckets];
+        total += position;
+        if (position > *max) {
+            *max = position;
+        }
+    }
+    *mean = (ht->length > 0) ? (double)total / (double)ht->length : 0.0;
+    free(chains);
+}
+
+static bool benchKeys(const char *label, const keyList *list, uint64_t *checksum) {
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        hashTable_config config = { 0, 0.0, true, 0, sizeof(uint64_t), variants[v].algorithm,
+                                    variants[v].randomSeed, false };
+        double hashRate = hashSpeed(hashFunctions_get(variants[v].algorithm), list, checksum);
+
+        hashTable *ht = hashTable_create(&config);
+        if (ht == NULL) {
+            return false;
+        }
+        double start = stats_now();
+        for (size_t i = 0; i < list->count; i++) {
+            if (hashTable_incrementOrInsertLen(ht, list->bytes + list->offsets[i],
+                                               list->offsets[i + 1] - list->offsets[i]) == NULL) {
+                hashTable_destroy(ht);
+                return false;
+            }
+        }
+        double elapsed = stats_now() - start;
+
+        double meanProbe = 0.0;
+        size_t maxProbe = 0;
+        double meanChain = 0.0;
+        size_t maxChain = 0;
+        hashTable_getProbeStats(ht, &meanProbe, &maxProbe);
+        chainStats(ht, &meanChain, &maxChain);
+
+        char name[32];
+        snprintf(name, sizeof(name), "%s%s", hashFunctions_name(variants[v].algorithm),
+                 variants[v].randomSeed ? "+seed" : "");
+        printf("%-10s %-12s %10zu %12.2f %12.2f %10.2f %10zu %10.2f %10zu\n", label, name,
+               hashTable_getLength(ht), hashRate, (double)list->count / elapsed / 1e6,
+               meanProbe, maxProbe, meanChain, maxChain);
+        hashTable_destroy(ht);
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t distinct = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 200000;
+    unsigned int floodBits = (argc > 3) ? (unsigned int)atoi(argv[3]) : 13;
+    keyList text = { 0 };
+    keyList synthetic = { 0 };
+    keyList flood = { 0 };
+    uint64_t checksum = 0;
+
+    if (floodBits > 24) {
+        floodBits = 24;
+    }
+    if (!loadTextKeys(path, &text) || !makeSyntheticKeys(distinct, &synthetic) ||
+        !makeFloodKeys(floodBits, &flood)) {
+        printf("Error preparing benchmark input\n");
+        freeKeys(&text);
+        freeKeys(&synthetic);
+        freeKeys(&flood);
+        return 1;
+    }
+
+    printf("%-10s %-12s %10s %12s %12s %10s %10s %10s %10s\n", "workload", "hash", "keys",
+           "Mhash/s", "Minsert/s", "meanProbe", "maxProbe", "meanChain", "maxChain");
+    bool ok = benchKeys("text", &text, &checksum) && benchKeys("synthetic", &synthetic, &checksum) &&
+              benchKeys("flood", &flood, &checksum);
+    if (!ok) {
+        printf("FAILED\n");
+    }
+    printf("checksum %016llx\n", (unsigned long long)checksum);
+
+    freeKeys(&text);
+    freeKeys(&synthetic);
+    freeKeys(&flood);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,271 @@
+/*
+ * hash table benchmark - open addressing hashTable vs. the chained reference table
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: hashTableBench [text file] [distinct synthetic keys] [passes]
+ *
+ * Three workloads are run against both engines, the open addressing table with
+ * per-key malloc(), with its keys and int counters in an arena, with an
+ * arena plus 64-bit counters stored inline in the slots, and with short keys
+ * stored in the slots too (inline_keys):
+ *   - the cleaned word stream of a text file, replayed for several passes
+ *   - a synthetic vocabulary of unique keys, inserted once then incremented
+ *   - the same vocabulary incremented in a shuffled order, so neither the
+ *     slots nor the keys are visited in the order they were allocated
+ * For each run the throughput of incrementOrInsert, then of lookup once every
+ * key is in (the same word stream looked up again), the probe length of a
+ * successful lookup (chain position for the chained table), the key reads
+ * per lookup that leave the slots (a likely cache miss each on tables
+ * larger than the cache) and the time taken by destroy are reported.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashTable_cfg.h"
+#include "hashTable.h"
+#include "stats.h"
+#include "utility.h"
+#include "chainedHashTable.h"
+
+// Bucket count the chained engine was always created with
+#define CHAINED_CAPACITY (1024)
+
+typedef struct {
+    char** words;       // cleaned words, in input order
+    size_t count;       // number of words
+} wordList;
+
+static bool appendWord(wordList* list, size_t* capacity, const char* word) {
+    if (list->count == *capacity) {
+        size_t newCapacity = (*capacity == 0) ? 4096 : *capacity * 2;
+        char** grown = realloc(list->words, newCapacity * sizeof(char*));
+        if (grown == NULL) {
+            return false;
+        }
+        list->words = grown;
+        *capacity = newCapacity;
+    }
+    list->words[list->count] = strdup(word);
+    if (list->words[list->count] == NULL) {
+        return false;
+    }
+    list->count++;
+    return true;
+}
+
+static bool loadTextWords(const char* path, wordList* list) {
+    FILE* fptr = fopen(path, "r");
+    char wordBuff[100];
+    size_t capacity = 0;
+
+    if (fptr == NULL) {
+        printf("Error opening file %s\n", path);
+        return false;
+    }
+    while (fscanf(fptr, "%99s", wordBuff) == 1) {
+        clean_and_lowercase(wordBuff);
+        if (wordBuff[0] != '\0' && !appendWord(list, &capacity, wordBuff)) {
+            fclose(fptr);
+            return false;
+        }
+    }
+    fclose(fptr);
+    return true;
+}
+
+static bool makeSyntheticWords(size_t distinct, wordList* list) {
+    char wordBuff[32];
+    size_t capacity = 0;
+
+    // Every key inserted once, then every key incremented once
+    for (size_t pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < distinct; i++) {
+            snprintf(wordBuff, sizeof(wordBuff), "key%zu", i);
+            if (!appendWord(list, &capacity, wordBuff)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// The synthetic vocabulary, incremented a second time in a shuffled order
+static bool makeShuffledWords(size_t distinct, wordList* list) {
+    if (!makeSyntheticWords(distinct, list)) {
+        return false;
+    }
+    uint64_t state = UINT64_C(0x9E3779B97F4A7C15);
+    char** second = list->words + distinct;
+    for (size_t i = distinct; i > 1; i--) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        size_t j = (size_t)(state % i);
+        char* swap = second[i - 1];
+        second[i - 1] = second[j];
+        second[j] = swap;
+    }
+    return true;
+}
+
+// Lookups that compare their key outside the slots: all of them, unless the key is inline
+static double keyReadsPerLookup(const hashTable* ht, const wordList* list) {
+    if (ht->key_offset == 0 || list->count == 0) {
+        return 1.0;
+    }
+    size_t spilled = 0;
+    for (size_t i = 0; i < list->count; i++) {
+        spilled += (strlen(list->words[i]) >= HASHTABLE_INLINE_KEY_SIZE);
+    }
+    return (double)spilled / (double)list->count;
+}
+
+static void freeWords(wordList* list) {
+    for (size_t i = 0; i < list->count; i++) {
+        free(list->words[i]);
+    }
+    free(list->words);
+}
+
+static void chainedProbeStats(const chainedHashTable* ht, double* mean, size_t* max) {
+    size_t total = 0;
+    *max = 0;
+    for (size_t i = 0; i < ht->capacity; i++) {
+        size_t position = 0;
+        for (chained_entry* entry = ht->entries[i]; entry != NULL; entry = entry->next) {
+            position++;
+            total += position; // a lookup walks every node up to this one
+        }
+        if (position > *max) {
+            *max = position;
+        }
+    }
+    *mean = (ht->length > 0) ? (double)total / (double)ht->length : 0.0;
+}
+
+static void benchOpenAddressing(const char* label, const char* engine, hashTable_config* config,
+                                const wordList* list, int passes) {
+    double elapsed = 0.0;
+    double lookupElapsed = 0.0;
+    double teardown = 0.0;
+    double meanProbe = 0.0;
+    size_t maxProbe = 0;
+    size_t distinct = 0;
+    size_t capacity = 0;
+    double keyReads = 0.0;
+
+    for (int pass = 0; pass < passes; pass++) {
+        hashTable* ht = hashTable_create(config);
+        double start = stats_now();
+        for (size_t i = 0; i < list->count; i++) {
+            hashTable_incrementOrInsert(ht, list->words[i]);
+        }
+        elapsed += stats_now() - start;
+        start = stats_now();
+        for (size_t i = 0; i < list->count; i++) {
+            hashTable_lookup(ht, list->words[i]);
+        }
+        lookupElapsed += stats_now() - start;
+        hashTable_getProbeStats(ht, &meanProbe, &maxProbe);
+        distinct = hashTable_getLength(ht);
+        capacity = ht->capacity;
+        keyReads = keyReadsPerLookup(ht, list);
+        start = stats_now();
+        hashTable_destroy(ht);
+        teardown += stats_now() - start;
+    }
+
+    printf("%-10s %-18s %10zu %10zu %12.0f %12.0f %10.2f %10zu %10.2f %10.2f\n", label, engine,
+           distinct, capacity, (double)list->count * passes / elapsed,
+           (double)list->count * passes / lookupElapsed, meanProbe, maxProbe, keyReads,
+           teardown * 1e3 / passes);
+}
+
+static void benchChained(const char* label, const wordList* list, int passes) {
+    double elapsed = 0.0;
+    double lookupElapsed = 0.0;
+    double teardown = 0.0;
+    double meanProbe = 0.0;
+    size_t maxProbe = 0;
+    size_t distinct = 0;
+
+    for (int pass = 0; pass < passes; pass++) {
+        chainedHashTable* ht = chainedHashTable_create(CHAINED_CAPACITY);
+        double start = stats_now();
+        for (size_t i = 0; i < list->count; i++) {
+            chainedHashTable_incrementOrInsert(ht, list->words[i]);
+        }
+        elapsed += stats_now() - start;
+        start = stats_now();
+        for (size_t i = 0; i < list->count; i++) {
+            chainedHashTable_lookup(ht, list->words[i]);
+        }
+        lookupElapsed += stats_now() - start;
+        chainedProbeStats(ht, &meanProbe, &maxProbe);
+        distinct = ht->length;
+        start = stats_now();
+        chainedHashTable_destroy(ht);
+        teardown += stats_now() - start;
+    }
+
+    // Every node walked is a strcmp() through its key pointer
+    printf("%-10s %-18s %10zu %10d %12.0f %12.0f %10.2f %10zu %10.2f %10.2f\n", label, "chained",
+           distinct, CHAINED_CAPACITY, (double)list->count * passes / elapsed,
+           (double)list->count * passes / lookupElapsed, meanProbe, maxProbe, meanProbe,
+           teardown * 1e3 / passes);
+}
+
+int main(int argc, char* argv[]) {
+    const char* path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t distinct = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 200000;
+    int passes = (argc > 3) ? atoi(argv[3]) : 5;
+    wordList text = {NULL, 0};
+    wordList synthetic = {NULL, 0};
+    wordList shuffled = {NULL, 0};
+
+    if (passes <= 0) {
+        passes = 1;
+    }
+    if (!loadTextWords(path, &text) || !makeSyntheticWords(distinct, &synthetic) ||
+        !makeShuffledWords(distinct, &shuffled)) {
+        printf("Error preparing benchmark input\n");
+        freeWords(&text);
+        freeWords(&synthetic);
+        freeWords(&shuffled);
+        return 1;
+    }
+
+    // Zero capacity and load factor keep the table defaults
+    hashTable_config arenaConfig = {0, 0.0, true, 0, 0, HASH_FUNCTION_DEFAULT, false, false};
+    hashTable_config inlineConfig = {0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, false};
+    hashTable_config keysConfig = {0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, true};
+
+    printf("%-10s %-18s %10s %10s %12s %12s %10s %10s %10s %10s\n", "workload", "engine",
+           "keys", "slots", "ops/sec", "lookups/sec", "meanProbe", "maxProbe", "keyReads", "destroyMs");
+    benchOpenAddressing("text", "open-addressing", NULL, &text, passes);
+    benchOpenAddressing("text", "open-addr+arena", &arenaConfig, &text, passes);
+    benchOpenAddressing("text", "open-addr+inline", &inlineConfig, &text, passes);
+    benchOpenAddressing("text", "open-addr+keys", &keysConfig, &text, passes);
+    benchChained("text", &text, passes);
+    benchOpenAddressing("synthetic", "open-addressing", NULL, &synthetic, passes);
+    benchOpenAddressing("synthetic", "open-addr+arena", &arenaConfig, &synthetic, passes);
+    benchOpenAddressing("synthetic", "open-addr+inline", &inlineConfig, &synthetic, passes);
+    benchOpenAddressing("synthetic", "open-addr+keys", &keysConfig, &synthetic, passes);
+    benchChained("synthetic", &synthetic, passes);
+    benchOpenAddressing("shuffled", "open-addressing", NULL, &shuffled, passes);
+    benchOpenAddressing("shuffled", "open-addr+arena", &arenaConfig, &shuffled, passes);
+    benchOpenAddressing("shuffled", "open-addr+inline", &inlineConfig, &shuffled, passes);
+    benchOpenAddressing("shuffled", "open-addr+keys", &keysConfig, &shuffled, passes);
+    benchChained("shuffled", &shuffled, passes);
+
+    freeWords(&text);
+    freeWords(&synthetic);
+    freeWords(&shuffled);
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+ * heavy hitters benchmark - Space-Saving summaries checked against exact counts
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: heavyHittersBench [text file] [top n] [synthetic MWords]
+ *
+ * Two inputs are counted exactly with the hash table and approximately with
+ * Space-Saving summaries of several memory budgets, with and without the
+ * Count-Min sketch:
+ *   - the text file
+ *   - a synthetic log-like stream where a few hot words are drowned in
+ *     unique identifiers, the case that makes the exact table grow unbounded
+ * Every monitored word is checked against its exact count: the count must
+ * lie in [count - error, count], and every word occurring more than
+ * total / counters times must be monitored. Any violation fails the
+ * benchmark. Recall of the exact top n and the mean relative overestimation
+ * of the returned top n are reported with the throughput.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashTable.h"
+#include "spaceSaving.h"
+#include "stats.h"
+#include "topN.h"
+#include "wordScanner.h"
+
+static const size_t budgetsKiB[] = { 64, 1024 };
+
+typedef struct {
+    char *data;         // input text
+    size_t length;      // bytes of text
+} input;
+
+static bool loadFile(const char *path, input *in) {
+    FILE *fptr = fopen(path, "rb");
+    if (fptr == NULL) {
+        printf("Error opening file %s\n", path);
+        return false;
+    }
+    fseek(fptr, 0, SEEK_END);
+    long size = ftell(fptr);
+    fseek(fptr, 0, SEEK_SET);
+    in->data = (size >= 0) ? malloc((size_t)size + 1) : NULL;
+    if (in->data == NULL) {
+        fclose(fptr);
+        return false;
+    }
+    in->length = fread(in->data, 1, (size_t)size, fptr);
+    fclose(fptr);
+    return in->length == (size_t)size;
+}
+
+// One word in four is one of 1000 hot words (skewed weights), the rest are unique ids
+static bool makeSynthetic(size_t words, input *in) {
+    uint64_t state = 88172645463325252ull;
+    size_t capacity = words * 16 + 1;
+    in->data = malloc(capacity);
+    in->length = 0;
+    if (in->data == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < words; i++) {
+        // xorshift64, deterministic across runs
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        int written;
+        if (state % 4 == 0) {
+            unsigned int hot = (unsigned int)((state >> 8) % 1000);
+            hot = hot * hot / 1000; // skew towards the first hot words
+            written = snprintf(in->data + in->length, capacity - in->length, "hot%u ", hot);
+        } else {
+            written = snprintf(in->data + in->length, capacity - in->length, "id%zx ", i);
+        }
+        in->length += (size_t)written;
+    }
+    return true;
+}
+
+static bool countExact(const char *word, size_t length, void *context) {
+    return hashTable_incrementOrInsertLen((hashTable *)context, word, length) != NULL;
+}
+
+static bool countApprox(const char *word, size_t length, void *context) {
+    return spaceSaving_add((spaceSaving *)context, word, length);
+}
+
+static bool scan(const input *in, wordScanner_callback callback, void *context) {
+    wordScanner scanner;
+    wordScanner_init(&scanner, callback, context);
+    bool ok = wordScanner_feed(&scanner, in->data, in->length) && wordScanner_finish(&scanner);
+    wordScanner_destroy(&scanner);
+    return ok;
+}
+
+static uint64_t exactCount(hashTable *exact, const char *word) {
+    const uint64_t *count = (const uint64_t *)hashTable_lookup(exact, word);
+    return (count != NULL) ? *count : 0;
+}
+
+// Checks the bounds of every monitored word and the frequency guarantee
+static bool checkSummary(spaceSaving *summary, hashTable *exact, bool useSketch) {
+    size_t capacity = spaceSaving_getCapacity(summary);
+    uint64_t total = spaceSaving_getTotal(summary);
+    spaceSaving_estimate *all = malloc(capacity * sizeof(spaceSaving_estimate));
+    size_t monitored = 0;
+    if (all == NULL || !spaceSaving_top(summary, capacity, all, &monitored)) {
+        free(all);
+        return false;
+    }
+
+    bool ok = true;
+    for (size_t i = 0; i < monitored && ok; i++) {
+        uint64_t truth = exactCount(exact, all[i].word);
+        if (truth > all[i].count || truth < all[i].count - all[i].error) {
+            printf("Bound violated for '%s': true %llu, count %llu, error %llu\n", all[i].word,
+                   (unsigned long long)truth, (unsigned long long)all[i].count,
+                   (unsigned long long)all[i].error);
+            ok = false;
+        }
+    }
+
+    // Without the sketch, words above total / capacity are always monitored
+    if (ok && !useSketch) {
+        hashTable_iterator iter;
+        hashTable_initIterator(exact, &iter);
+        const char *word;
+        void *value;
+        size_t heavy = 0;
+        while (hashTable_iteratorNext(&iter, &word, &value)) {
+            heavy += *(const uint64_t *)value > total / capacity;
+        }
+        size_t found = 0;
+        for (size_t i = 0; i < monitored; i++) {
+            found += exactCount(exact, all[i].word) > total / capacity;
+        }
+        if (found != heavy) {
+            printf("Only %zu of %zu words above total/capacity are monitored\n", found, heavy);
+            ok = false;
+        }
+    }
+    free(all);
+    return ok;
+}
+
+static bool benchInput(const char *label, const input *in, size_t n) {
+    hashTable_config exactConfig = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, false };
+    hashTable *exact = hashTable_create(&exactConfig);
+    WordCount *exactTop = malloc((n + 1) * sizeof(WordCount));
+    spaceSaving_estimate *approxTop = malloc((n + 1) * sizeof(spaceSaving_estimate));
+    size_t exactSelected = 0;
+    bool ok = exact != NULL && exactTop != NULL && approxTop != NULL;
+
+    double start = stats_now();
+    ok = ok && scan(in, countExact, exact);
+    double exactTime = stats_now() - start;
+    ok = ok && topN_select(exact, n, exactTop, &exactSelected);
+    if (ok) {
+        // The exact table needs one entry per distinct word
+        uint64_t total = 0;
+        hashTable_iterator iter;
+        hashTable_initIterator(exact, &iter);
+        const char *word;
+        void *value;
+        while (hashTable_iteratorNext(&iter, &word, &value)) {
+            total += *(const uint64_t *)value;
+        }
+        printf("%-10s %8s %-6s %10zu %10.2f %8.3f %10d %10.4f\n", label, "exact", "-",
+               hashTable_getLength(exact), (double)total / exactTime / 1e6, 1.0, 0, 0.0);
+    }
+
+    for (size_t b = 0; ok && b < sizeof(budgetsKiB) / sizeof(budgetsKiB[0]); b++) {
+        for (int useSketch = 0; ok && useSketch <= 1; useSketch++) {
+            spaceSaving_config config = { budgetsKiB[b] * 1024, useSketch != 0 };
+            spaceSaving *summary = spaceSaving_create(&config);
+            size_t approxSelected = 0;
+            ok = summary != NULL;
+
+            start = stats_now();
+            ok = ok && scan(in, countApprox, summary);
+            double elapsed = stats_now() - start;
+            ok = ok && spaceSaving_top(summary, n, approxTop, &approxSelected) &&
+                 checkSummary(summary, exact, useSketch != 0);
+
+            if (ok) {
+                // Recall of the exact top n, and how far the returned counts overestimate
+                size_t hits = 0;
+                uint64_t maxError = 0;
+                double relativeError = 0.0;
+                for (size_t i = 0; i < approxSelected; i++) {
+                    uint64_t truth = exactCount(exact, approxTop[i].word);
+                    relativeError += (double)(approxTop[i].count - truth) / (double)truth;
+                    if (approxTop[i].error > maxError) {
+                        maxError = approxTop[i].error;
+                    }
+                    for (size_t j = 0; j < exactSelected; j++) {
+                        if (strcmp(exactTop[j].word, approxTop[i].word) == 0) {
+                            hits++;
+                            break;
+                        }
+                    }
+                }
+                printf("%-10s %8zu %-6s %10zu %10.2f %8.3f %10llu %10.4f\n", label, budgetsKiB[b],
+                       useSketch ? "yes" : "no", spaceSaving_getCapacity(summary),
+                       (double)spaceSaving_getTotal(summary) / elapsed / 1e6,
+                       exactSelected > 0 ? (double)hits / (double)exactSelected : 1.0,
+                       (unsigned long long)maxError,
+                       approxSelected > 0 ? relativeError / (double)approxSelected : 0.0);
+            }
+            spaceSaving_destroy(summary);
+        }
+    }
+
+    hashTable_destroy(exact);
+    free(exactTop);
+    free(approxTop);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t n = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 100;
+    size_t syntheticWords = ((argc > 3) ? (size_t)strtoull(argv[3], NULL, 10) : 5) * 1000000;
+    input text = { NULL, 0 };
+    input synthetic = { NULL, 0 };
+
+    if (!loadFile(path, &text) || !makeSynthetic(syntheticWords, &synthetic)) {
+        printf("Error preparing benchmark input\n");
+        free(text.data);
+        free(synthetic.data);
+        return 1;
+    }
+
+    printf("%-10s %8s %-6s %10s %10s %8s %10s %10s\n", "input", "budgetKiB", "sketch",
+           "counters", "Mwords/s", "recall", "maxError", "meanRelErr");
+    bool ok = benchInput("text", &text, n) && benchInput("synthetic", &synthetic, n);
+    if (!ok) {
+        printf("FAILED\n");
+    }
+
+    free(text.data);
+    free(synthetic.data);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+/*
+ * n-gram benchmark - token-id n-grams vs. joined string keys
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: ngramBench [text file] [largest n]
+ *
+ * The cleaned words of the text file are counted as n-grams for n = 1 up to
+ * [largest n], in two ways:
+ *   - ngramCounter: token ids and a rolling hash, no phrase is ever joined
+ *   - joined:       each phrase copied into a buffer, words separated by
+ *                   spaces, and counted in a hashTable like single words are
+ * For both, the throughput in words per second and the heap memory held at
+ * the end are reported. The n = 1 joined row is plain word counting, the
+ * reference the n-gram rows should stay close to. Every phrase of the joined
+ * table must have the same count in the ngramCounter, and both must hold the
+ * same number of distinct phrases. Any mismatch fails the benchmark.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashTable.h"
+#include "ngramCounter_cfg.h"
+#include "ngramCounter.h"
+#include "stats.h"
+#include "wordList.h"
+
+// Count the phrases of n words by joining them, as a naive n-gram mode would
+static hashTable *countJoined(const wordList *list, size_t n, double *elapsed) {
+    hashTable_config config = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, false };
+    hashTable *joined = hashTable_create(&config);
+    size_t capacity = 256;
+    char *phrase = malloc(capacity);
+    bool ok = joined != NULL && phrase != NULL;
+
+    double start = stats_now();
+    for (size_t i = 0; ok && i + n <= list->count; i++) {
+        size_t length = 0;
+        for (size_t w = i; w < i + n; w++) {
+            size_t wordLength = list->offsets[w + 1] - list->offsets[w];
+            if (length + wordLength + 1 > capacity) {
+                capacity = (length + wordLength + 1) * 2;
+                char *grown = realloc(phrase, capacity);
+                if (grown == NULL) {
+                    ok = false;
+                    break;
+                }
+                phrase = grown;
+            }
+            if (w > i) {
+                phrase[length++] = ' ';
+            }
+            memcpy(phrase + length, list->bytes + list->offsets[w], wordLength);
+            length += wordLength;
+        }
+        ok = ok && hashTable_incrementOrInsertLen(joined, phrase, length) != NULL;
+    }
+    *elapsed = stats_now() - start;
+    free(phrase);
+    if (!ok) {
+        hashTable_destroy(joined);
+        return NULL;
+    }
+    return joined;
+}
+
+// Every joined phrase has the same count in the counter, and there are as many
+static bool checkCounts(hashTable *joined, ngramCounter *counter) {
+    if (hashTable_getLength(joined) != ngramCounter_getLength(counter)) {
+        printf("Joined table holds %zu phrases, counter %zu\n", hashTable_getLength(joined),
+               ngramCounter_getLength(counter));
+        return false;
+    }
+    hashTable_iterator iter;
+    hashTable_initIterator(joined, &iter);
+    const char *phrase;
+    void *value;
+    while (hashTable_iteratorNext(&iter, &phrase, &value)) {
+        uint64_t expected = *(const uint64_t *)value;
+        uint64_t actual = ngramCounter_count(counter, phrase, strlen(phrase));
+        if (actual != expected) {
+            printf("Phrase '%s': counter %llu, joined %llu\n", phrase, (unsigned long long)actual,
+                   (unsigned long long)expected);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t largest = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 3;
+    wordList list = { 0 };
+
+    if (largest == 0) {
+        largest = 1;
+    }
+    if (largest > NGRAMCOUNTER_MAX_SIZE) {
+        largest = NGRAMCOUNTER_MAX_SIZE;
+    }
+    if (!wordList_load(path, &list) || list.count == 0) {
+        printf("Error preparing benchmark input\n");
+        wordList_free(&list);
+        return 1;
+    }
+
+    printf("%zu words\n", list.count);
+    printf("%-3s %-13s %10s %10s %10s %12s\n", "n", "engine", "distinct", "Mwords/s", "MiB", "bytes/phrase");
+    bool ok = true;
+    for (size_t n = 1; ok && n <= largest; n++) {
+        ngramCounter *counter = ngramCounter_create(n);
+        ok = counter != NULL;
+        double start = stats_now();
+        for (size_t i = 0; ok && i < list.count; i++) {
+            ok = ngramCounter_addWord(list.bytes + list.offsets[i], list.offsets[i + 1] - list.offsets[i], counter);
+        }
+        double counterTime = stats_now() - start;
+
+        double joinedTime = 0.0;
+        hashTable *joined = ok ? countJoined(&list, n, &joinedTime) : NULL;
+        ok = ok && joined != NULL;
+
+        if (ok) {
+            size_t distinct = ngramCounter_getLength(counter);
+            size_t memory = ngramCounter_getMemory(counter);
+            printf("%-3zu %-13s %10zu %10.2f %10.1f %12.1f\n", n, "ngramCounter", distinct,
+                   (double)list.count / counterTime / 1e6, (double)memory / (1024.0 * 1024.0),
+                   distinct > 0 ? (double)memory / (double)distinct : 0.0);
+            printf("%-3zu %-13s %10zu %10.2f %10.1f %12.1f\n", n, "joined", hashTable_getLength(joined),
+                   (double)list.count / joinedTime / 1e6, (double)hashTable_getMemoryUsage(joined) / (1024.0 * 1024.0),
+                   hashTable_getLength(joined) > 0 ? (double)hashTable_getMemoryUsage(joined) / (double)hashTable_getLength(joined)
+                                                   : 0.0);
+            ok = checkCounts(joined, counter);
+        }
+        hashTable_destroy(joined);
+        ngramCounter_destroy(counter);
+    }
+    if (!ok) {
+        printf("FAILED\n");
+    }
+
+    wordList_free(&list);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+/*
+ * pipeline benchmark - per-phase timings of find_frequent_words
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: pipelineBench [-j threads] [-n top] [-l label] file...
+ *
+ * For every file the serial pipeline is timed phase by phase:
+ *   - read_tokenize: map/read the file and split it into cleaned words
+ *   - count:         the same scan hashing and inserting every word, minus read_tokenize
+ *   - rank:          top-n selection from the table
+ * then find_frequent_words_ranked() is timed end to end with the given thread
+ * count. An untimed scan warms the page cache first, so the numbers measure
+ * the program rather than the disk.
+ *
+ * One JSON object is printed per file, on a single line, so runs can be
+ * appended to a log and compared across releases:
+ *   {"label":..,"file":..,"bytes":..,"words":..,"distinct":..,"threads":..,
+ *    "read_tokenize_s":..,"count_s":..,"rank_s":..,"end_to_end_s":..,
+ *    "words_per_s":..,"mb_per_s":..,"peak_rss_kib":..,
+ *    "table":{"capacity":..,"load_factor":..,"mean_probe":..,"max_probe":..}}
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "fileReader.h"
+#include "hashTable.h"
+#include "mostFrequentWords.h"
+#include "stats.h"
+#include "topN.h"
+#include "wordScanner.h"
+
+typedef struct {
+    hashTable *freqMap;     // NULL when only tokenizing
+    uint64_t words;         // words seen by the scanner
+} scanContext;
+
+static long peakRssKib(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+    return usage.ru_maxrss; // KiB on Linux
+}
+
+static bool onWord(const char *word, size_t length, void *context) {
+    (void)word;
+    (void)length;
+    scanContext *scan = (scanContext *)context;
+    scan->words++;
+    return true;
+}
+
+// Counts like find_frequent_words: the scanner hashes each word for the table
+static bool onHashedWord(const char *word, size_t length, uint64_t hash, void *context) {
+    scanContext *scan = (scanContext *)context;
+    scan->words++;
+    return hashTable_incrementOrInsertHashed(scan->freqMap, word, length, (size_t)hash) != NULL;
+}
+
+static bool scanFile(const char *path, scanContext *scan) {
+    wordScanner scanner;
+    if (scan->freqMap == NULL) {
+        wordScanner_init(&scanner, onWord, scan);
+    } else {
+        wordScanner_initHashed(&scanner, onHashedWord, scan->freqMap->hash_function,
+                               scan->freqMap->hash_seed, scan);
+    }
+    bool ok = fileReader_scanFile(path, &scanner);
+    wordScanner_destroy(&scanner);
+    return ok;
+}
+
+// Prints a JSON string, escaping what a file name may contain
+static void printJsonString(const char *text) {
+    putchar('"');
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            printf("\\%c", *c);
+        } else if (*c < 0x20) {
+            printf("\\u%04x", *c);
+        } else {
+            putchar(*c);
+        }
+    }
+    putchar('"');
+}
+
+static bool benchFile(const char *label, const char *path, const frequentWords_config *config, int32_t n) {
+    fileReader_mapping mapping;
+    uint64_t bytes = 0;
+    if (fileReader_map(path, &mapping)) {
+        bytes = mapping.length;
+        fileReader_unmap(&mapping);
+    }
+
+    // Warm the page cache, then time tokenizing alone
+    scanContext tokenize = { NULL, 0 };
+    if (!scanFile(path, &tokenize)) {
+        printf("Error reading file %s\n", path);
+        return false;
+    }
+    tokenize.words = 0;
+    double start = stats_now();
+    scanFile(path, &tokenize);
+    double tokenizeTime = stats_now() - start;
+
+    // Same table configuration as find_frequent_words
+    hashTable_config tableConfig = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, true };
+    scanContext count = { hashTable_create(&tableConfig), 0 };
+    if (count.freqMap == NULL) {
+        return false;
+    }
+    start = stats_now();
+    bool ok = scanFile(path, &count);
+    double countTime = stats_now() - start - tokenizeTime;
+
+    WordCount *top = malloc(((size_t)n + 1) * sizeof(WordCount));
+    size_t selected = 0;
+    start = stats_now();
+    ok = ok && top != NULL && topN_select(count.freqMap, (size_t)n, top, &selected);
+    double rankTime = stats_now() - start;
+    free(top);
+
+    double meanProbe = 0.0;
+    size_t maxProbe = 0;
+    hashTable_getProbeStats(count.freqMap, &meanProbe, &maxProbe);
+    size_t distinct = hashTable_getLength(count.freqMap);
+    size_t capacity = count.freqMap->capacity;
+    hashTable_destroy(count.freqMap);
+
+    start = stats_now();
+    frequentWords_ranking *result = ok ? find_frequent_words_ranked(path, n, config) : NULL;
+    double endToEnd = stats_now() - start;
+    if (result == NULL) {
+        printf("Error running find_frequent_words_ranked on %s\n", path);
+        return false;
+    }
+    frequentWords_freeRanking(result);
+
+    printf("{\"label\":");
+    printJsonString(label);
+    printf(",\"file\":");
+    printJsonString(path);
+    printf(",\"bytes\":%llu,\"words\":%llu,\"distinct\":%zu,\"threads\":%zu",
+           (unsigned long long)bytes, (unsigned long long)count.words, distinct, config->thread_count);
+    printf(",\"read_tokenize_s\":%.6f,\"count_s\":%.6f,\"rank_s\":%.6f,\"end_to_end_s\":%.6f",
+           tokenizeTime, countTime > 0.0 ? countTime : 0.0, rankTime, endToEnd);
+    printf(",\"words_per_s\":%.0f,\"mb_per_s\":%.2f,\"peak_rss_kib\":%ld",
+           (double)count.words / endToEnd, (double)bytes / 1e6 / endToEnd, peakRssKib());
+    printf(",\"table\":{\"capacity\":%zu,\"load_factor\":%.4f,\"mean_probe\":%.4f,\"max_probe\":%zu}}\n",
+           capacity, (double)distinct / (double)capacity, meanProbe, maxProbe);
+    fflush(stdout);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    frequentWords_config config = { 1, FREQUENT_WORDS_EXACT, 0, false, NULL, 0, NULL, RANKDUMP_TSV, NULL };
+    int32_t n = 10;
+    const char *label = "";
+    int argi = 1;
+
+    while (argi + 1 < argc && argv[argi][0] == '-') {
+        if (strcmp(argv[argi], "-j") == 0) {
+            config.thread_count = (size_t)strtoul(argv[argi + 1], NULL, 10);
+        } else if (strcmp(argv[argi], "-n") == 0) {
+            n = (int32_t)atoi(argv[argi + 1]);
+        } else if (strcmp(argv[argi], "-l") == 0) {
+            label = argv[argi + 1];
+        } else {
+            break;
+        }
+        argi += 2;
+    }
+    if (argi >= argc) {
+        printf("Usage: pipelineBench [-j threads] [-n top] [-l label] file...\n");
+        return 1;
+    }
+
+    bool ok = true;
+    for (; argi < argc; argi++) {
+        ok = benchFile(label, argv[argi], &config, n) && ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+/*
+ * rank dump benchmark - counting sort ranking vs. qsort of the whole vocabulary
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: rankDumpBench [text file] [distinct synthetic words] [passes]
+ *
+ * Every word of a table is ranked in two ways:
+ *   - qsort:    the words and counts copied into a WordCount array, sorted
+ *               with cmpWordCount() (count descending, strcmp tie-break)
+ *   - rankDump: rankDump_rankTable(), a counting sort on the counts and a
+ *               multikey quicksort within each count
+ * on two tables: the words of the text file, and a synthetic vocabulary
+ * with Zipf distributed counts (word i counted about total / i times), so
+ * most words share a small count as in real text. The best time of the
+ * passes is reported in million words per second. Both rankings must be
+ * identical, any difference fails the benchmark.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashTable.h"
+#include "rankDump.h"
+#include "stats.h"
+#include "topN.h"
+#include "wordScanner.h"
+
+// Collects the ranking of rankDump_rankTable()
+typedef struct {
+    WordCount *ranked;  // words in the order they were passed
+    size_t count;       // words passed so far
+} rankList;
+
+static bool countWord(const char *word, size_t length, void *context) {
+    return hashTable_incrementOrInsertLen((hashTable *)context, word, length) != NULL;
+}
+
+static bool loadText(const char *path, hashTable *table) {
+    FILE *fptr = fopen(path, "rb");
+    char buffer[65536];
+    size_t got;
+    if (fptr == NULL) {
+        printf("Error opening file %s\n", path);
+        return false;
+    }
+    wordScanner scanner;
+    wordScanner_init(&scanner, countWord, table);
+    bool ok = true;
+    while (ok && (got = fread(buffer, 1, sizeof(buffer), fptr)) > 0) {
+        ok = wordScanner_feed(&scanner, buffer, got);
+    }
+    ok = ok && wordScanner_finish(&scanner);
+    wordScanner_destroy(&scanner);
+    fclose(fptr);
+    return ok;
+}
+
+// Word i of distinct gets a count of about distinct / i, at least 1
+static bool makeZipf(size_t distinct, hashTable *table) {
+    char word[32];
+    uint64_t state = UINT64_C(0x9E3779B97F4A7C15);
+    for (size_t i = 1; i <= distinct; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        int length = snprintf(word, sizeof(word), "w%llx", (unsigned long long)(state % (distinct * 16)));
+        uint64_t count = distinct / i;
+        count = (count > 0) ? count : 1;
+        size_t before = hashTable_getLength(table);
+        uint64_t *value = (uint64_t *)hashTable_findOrInsertLen(table, word, (size_t)length, &count);
+        if (value == NULL) {
+            return false;
+        }
+        if (hashTable_getLength(table) == before) {
+            *value += count; // a repeated random word adds up
+        }
+    }
+    return true;
+}
+
+static bool collect(const char *word, size_t length, uint64_t count, void *context) {
+    (void)length;
+    rankList *list = (rankList *)context;
+    list->ranked[list->count].word = word;
+    list->ranked[list->count].count = count;
+    list->count++;
+    return true;
+}
+
+static bool benchTable(const char *label, hashTable *table, int passes) {
+    size_t length = hashTable_getLength(table);
+    WordCount *sorted = (WordCount *)malloc((length + 1) * sizeof(WordCount));
+    rankList list = { (WordCount *)malloc((length + 1) * sizeof(WordCount)), 0 };
+    if (sorted == NULL || list.ranked == NULL) {
+        free(sorted);
+        free(list.ranked);
+        return false;
+    }
+
+    double sortTime = 0.0;
+    double rankTime = 0.0;
+    bool ok = true;
+    for (int pass = 0; ok && pass < passes; pass++) {
+        double start = stats_now();
+        hashTable_iterator iter;
+        hashTable_initIterator(table, &iter);
+        const char *key;
+        void *value;
+        size_t count = 0;
+        while (hashTable_iteratorNext(&iter, &key, &value)) {
+            sorted[count].word = key;
+            sorted[count].count = *(const uint64_t *)value;
+            count++;
+        }
+        qsort(sorted, count, sizeof(WordCount), cmpWordCount);
+        double elapsed = stats_now() - start;
+        sortTime = (pass == 0 || elapsed < sortTime) ? elapsed : sortTime;
+
+        list.count = 0;
+        start = stats_now();
+        ok = rankDump_rankTable(table, collect, &list);
+        elapsed = stats_now() - start;
+        rankTime = (pass == 0 || elapsed < rankTime) ? elapsed : rankTime;
+    }
+
+    for (size_t i = 0; ok && i < length; i++) {
+        if (list.ranked[i].count != sorted[i].count || strcmp(list.ranked[i].word, sorted[i].word) != 0) {
+            printf("Rank %zu: rankDump '%s' (%llu), qsort '%s' (%llu)\n", i + 1, list.ranked[i].word,
+                   (unsigned long long)list.ranked[i].count, sorted[i].word, (unsigned long long)sorted[i].count);
+            ok = false;
+        }
+    }
+    ok = ok && list.count == length;
+
+    size_t ones = 0;
+    for (size_t i = 0; i < length; i++) {
+        ones += (sorted[i].count == 1);
+    }
+    printf("%-10s %10zu %9.1f%% %12.2f %12.2f %8.2fx\n", label, length,
+           length > 0 ? 100.0 * (double)ones / (double)length : 0.0,
+           (double)length / sortTime / 1e6, (double)length / rankTime / 1e6, sortTime / rankTime);
+    free(sorted);
+    free(list.ranked);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t distinct = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 2000000;
+    int passes = (argc > 3) ? atoi(argv[3]) : 3;
+    hashTable_config config = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, true };
+    hashTable *text = hashTable_create(&config);
+    hashTable *zipf = hashTable_create(&config);
+
+    if (passes <= 0) {
+        passes = 1;
+    }
+    if (text == NULL || zipf == NULL || !loadText(path, text) || !makeZipf(distinct, zipf)) {
+        printf("Error preparing benchmark input\n");
+        hashTable_destroy(text);
+        hashTable_destroy(zipf);
+        return 1;
+    }
+
+    printf("%-10s %10s %10s %12s %12s %9s\n", "table", "words", "count=1", "qsort Mw/s", "rank Mw/s", "speedup");
+    bool ok = benchTable("text", text, passes);
+    ok = benchTable("zipf", zipf, passes) && ok;
+    if (!ok) {
+        printf("FAILED\n");
+    }
+
+    hashTable_destroy(text);
+    hashTable_destroy(zipf);
+    return ok ? 0 : 1;
+}
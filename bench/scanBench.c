@@ -0,0 +1,266 @@
+/*
+ * scan benchmark - throughput of the byte classification kernels
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: scanBench [text file] [synthetic MiB] [passes]
+ *
+ * For every kernel supported by the CPU, the text file, a synthetic input of
+ * mixed-case ASCII words and punctuation, and a synthetic multilingual UTF-8
+ * input of the same size are run through:
+ *   - classify: charClass_classifyBlock over the whole input
+ *   - clean:    clean_and_lowercase_slice over the whole input
+ *   - scan:     wordScanner_feed, counting words without a hash table
+ * Each kernel's masks and cleaned output are checked against the scalar
+ * kernel before timing, so a wrong kernel fails the benchmark. The ASCII
+ * inputs never leave the block kernels, the UTF-8 one shows the cost of
+ * cleaning a code point at a time.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "charClass.h"
+#include "stats.h"
+#include "utility.h"
+#include "wordScanner.h"
+
+static const char *kernelNames[] = { "scalar", "sse2", "avx2" };
+
+// Keeps the timed loops from being optimized away
+static volatile uint64_t benchSink;
+
+typedef struct {
+    char *data;         // input bytes, padded to a whole number of blocks
+    size_t length;      // number of input bytes
+} input;
+
+static bool allocInput(input *in, size_t length) {
+    size_t padded = (length / CHARCLASS_BLOCK_SIZE + 1) * CHARCLASS_BLOCK_SIZE;
+    in->data = malloc(padded);
+    if (in->data == NULL) {
+        return false;
+    }
+    memset(in->data + length, ' ', padded - length);
+    in->length = length;
+    return true;
+}
+
+static bool loadFile(const char *path, input *in) {
+    FILE *fptr = fopen(path, "rb");
+    if (fptr == NULL) {
+        printf("Error opening file %s\n", path);
+        return false;
+    }
+    fseek(fptr, 0, SEEK_END);
+    long size = ftell(fptr);
+    fseek(fptr, 0, SEEK_SET);
+    if (size < 0 || !allocInput(in, (size_t)size)) {
+        fclose(fptr);
+        return false;
+    }
+    bool ok = fread(in->data, 1, (size_t)size, fptr) == (size_t)size;
+    fclose(fptr);
+    return ok;
+}
+
+static bool makeSynthetic(size_t mebibytes, input *in) {
+    static const char separators[] = " \n\t ";
+    static const char punctuation[] = ",.;:!?'\"-()";
+    size_t length = mebibytes * 1024 * 1024;
+    uint64_t state = 88172645463325252ull;
+
+    if (!allocInput(in, length)) {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++) {
+        // xorshift64, deterministic across runs
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        unsigned int roll = (unsigned int)(state % 100);
+        char c;
+        if (roll < 16) {
+            c = separators[state % (sizeof(separators) - 1)];
+        } else if (roll < 22) {
+            c = punctuation[state % (sizeof(punctuation) - 1)];
+        } else if (roll < 30) {
+            c = (char)('A' + (state >> 8) % 26);
+        } else {
+            c = (char)('a' + (state >> 8) % 26);
+        }
+        in->data[i] = c;
+    }
+    return true;
+}
+
+// Mixed scripts, curly quotes, dashes and no-break spaces, as multilingual text has
+static bool makeUtf8Synthetic(size_t mebibytes, input *in) {
+    static const char *const words[] = {
+        "the", "Straße", "ΕΛΛΗΝΙΚΑ", "ελληνικά", "Москва", "москва", "日本語", "テスト",
+        "café", "CAFÉ", "naïve", "“quoted”", "‘single’", "word—word", "«guillemets»",
+        "¿Qué?", "İstanbul", "x\xC2\xA0y", "😀", "Zürich", "and", "Ωμέγα", "don't", "Ünïcödé"
+    };
+    static const char separators[] = " \n\t ";
+    size_t wordCount = sizeof(words) / sizeof(words[0]);
+    size_t length = mebibytes * 1024 * 1024;
+    uint64_t state = 88172645463325252ull;
+
+    if (!allocInput(in, length)) {
+        return false;
+    }
+    size_t i = 0;
+    while (i < length) {
+        // xorshift64, deterministic across runs
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const char *word = words[state % wordCount];
+        size_t wordLength = strlen(word);
+        if (i + wordLength + 1 > length) {
+            break;
+        }
+        memcpy(in->data + i, word, wordLength);
+        i += wordLength;
+        in->data[i++] = separators[(state >> 8) % (sizeof(separators) - 1)];
+    }
+    memset(in->data + i, ' ', length - i);
+    return true;
+}
+
+static bool countWords(const char *word, size_t length, void *context) {
+    (void)word;
+    *(size_t *)context += length > 0;
+    return true;
+}
+
+// Reference masks and cleaned bytes from the scalar kernel
+static bool matchesScalar(const input *in, const char *kernel, char *cleanedRef, size_t cleanedRefLength,
+                          char *cleaned) {
+    size_t blocks = in->length / CHARCLASS_BLOCK_SIZE + 1;
+    for (size_t b = 0; b < blocks; b++) {
+        charClass_masks expected;
+        charClass_masks actual;
+        char lowerExpected[CHARCLASS_BLOCK_SIZE];
+        char lowerActual[CHARCLASS_BLOCK_SIZE];
+        const char *block = in->data + b * CHARCLASS_BLOCK_SIZE;
+
+        charClass_selectKernel("scalar");
+        charClass_classifyBlock(block, &expected);
+        charClass_lowercaseBlock(block, lowerExpected);
+        charClass_selectKernel(kernel);
+        charClass_classifyBlock(block, &actual);
+        charClass_lowercaseBlock(block, lowerActual);
+
+        if (expected.whitespace != actual.whitespace || expected.punctuation != actual.punctuation ||
+            expected.uppercase != actual.uppercase || expected.nonAscii != actual.nonAscii ||
+            memcmp(lowerExpected, lowerActual, CHARCLASS_BLOCK_SIZE) != 0) {
+            printf("Kernel %s differs from scalar in block %zu\n", kernel, b);
+            return false;
+        }
+    }
+
+    size_t cleanedLength = clean_and_lowercase_slice(cleaned, in->data, in->length);
+    if (cleanedLength != cleanedRefLength || memcmp(cleaned, cleanedRef, cleanedLength) != 0) {
+        printf("Kernel %s cleans differently from scalar\n", kernel);
+        return false;
+    }
+    return true;
+}
+
+static bool benchInput(const char *label, const input *in, int passes) {
+    char *cleaned = malloc(in->length + 1);
+    char *cleanedRef = malloc(in->length + 1);
+    if (cleaned == NULL || cleanedRef == NULL) {
+        free(cleaned);
+        free(cleanedRef);
+        return false;
+    }
+    charClass_selectKernel("scalar");
+    size_t cleanedRefLength = clean_and_lowercase_slice(cleanedRef, in->data, in->length);
+
+    bool ok = true;
+    double gigabytes = (double)in->length * passes / 1e9;
+    for (size_t k = 0; k < sizeof(kernelNames) / sizeof(kernelNames[0]) && ok; k++) {
+        if (!charClass_selectKernel(kernelNames[k])) {
+            continue; // Not supported on this CPU
+        }
+        ok = matchesScalar(in, kernelNames[k], cleanedRef, cleanedRefLength, cleaned);
+        if (!ok) {
+            break;
+        }
+
+        uint64_t sink = 0;
+        double start = stats_now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (size_t offset = 0; offset < in->length; offset += CHARCLASS_BLOCK_SIZE) {
+                charClass_masks masks;
+                charClass_classifyBlock(in->data + offset, &masks);
+                sink += masks.whitespace ^ masks.punctuation ^ masks.uppercase ^ masks.nonAscii;
+            }
+        }
+        double classifyTime = stats_now() - start;
+
+        start = stats_now();
+        for (int pass = 0; pass < passes; pass++) {
+            sink += clean_and_lowercase_slice(cleaned, in->data, in->length);
+        }
+        double cleanTime = stats_now() - start;
+
+        size_t words = 0;
+        wordScanner scanner;
+        wordScanner_init(&scanner, countWords, &words);
+        start = stats_now();
+        for (int pass = 0; pass < passes; pass++) {
+            wordScanner_feed(&scanner, in->data, in->length);
+            wordScanner_finish(&scanner);
+        }
+        double scanTime = stats_now() - start;
+        wordScanner_destroy(&scanner);
+
+        printf("%-12s %10.1f %-8s %12.2f %12.2f %12.2f %12zu\n", label, (double)in->length / 1e6,
+               kernelNames[k], gigabytes / classifyTime, gigabytes / cleanTime,
+               gigabytes / scanTime, words / (size_t)passes);
+        benchSink = sink;
+    }
+
+    free(cleaned);
+    free(cleanedRef);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t mebibytes = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 64;
+    int passes = (argc > 3) ? atoi(argv[3]) : 5;
+    input text = { NULL, 0 };
+    input synthetic = { NULL, 0 };
+    input utf8 = { NULL, 0 };
+    const char *bestKernel = charClass_kernelName();
+
+    if (passes <= 0) {
+        passes = 1;
+    }
+    if (!loadFile(path, &text) || !makeSynthetic(mebibytes, &synthetic) || !makeUtf8Synthetic(mebibytes, &utf8)) {
+        printf("Error preparing benchmark input\n");
+        free(text.data);
+        free(synthetic.data);
+        free(utf8.data);
+        return 1;
+    }
+
+    printf("default kernel: %s\n", bestKernel);
+    printf("%-12s %10s %-8s %12s %12s %12s %12s\n", "input", "MB", "kernel",
+           "classifyGB/s", "cleanGB/s", "scanGB/s", "words");
+    bool ok = benchInput("text", &text, passes) && benchInput("synthetic", &synthetic, passes) &&
+              benchInput("utf8", &utf8, passes);
+
+    free(text.data);
+    free(synthetic.data);
+    free(utf8.data);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+/*
+ * sliding window benchmark - windowed counting checked against recounts
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: slidingWindowBench [text file] [top n] [words per tick]
+ *
+ * The words of the text file are streamed into a window of 60 buckets of
+ * one tick each, the clock advancing one tick every [words per tick] words,
+ * so buckets keep expiring while words are added. The top n is queried ten
+ * times per tick, as a live dashboard would, and the latency of the queries
+ * is reported with the ingestion rate.
+ * Halfway through and at the end, the window is checked against an exact
+ * recount of the words inside it: the top n, the number of distinct words
+ * (zero counts must be evicted) and the total must all match. Any mismatch
+ * fails the benchmark.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashTable.h"
+#include "slidingWindow.h"
+#include "stats.h"
+#include "topN.h"
+#include "wordList.h"
+
+// Buckets of the window, one tick each
+#define WINDOW_BUCKETS (60)
+// Queries of the top n per tick
+#define QUERIES_PER_TICK (10)
+
+// Recount the words still inside the window after word end - 1 and compare
+static bool checkWindow(slidingWindow *window, const wordList *list, size_t end, size_t wordsPerTick, size_t n) {
+    uint64_t newestTick = (end - 1) / wordsPerTick;
+    uint64_t firstTick = (newestTick + 1 > WINDOW_BUCKETS) ? newestTick + 1 - WINDOW_BUCKETS : 0;
+    hashTable_config config = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, false };
+    hashTable *exact = hashTable_create(&config);
+    WordCount *expected = malloc((n + 1) * sizeof(WordCount));
+    WordCount *actual = malloc((n + 1) * sizeof(WordCount));
+    size_t expectedCount = 0;
+    size_t actualCount = 0;
+    bool ok = exact != NULL && expected != NULL && actual != NULL;
+
+    for (size_t i = (size_t)firstTick * wordsPerTick; ok && i < end; i++) {
+        ok = hashTable_incrementOrInsertLen(exact, list->bytes + list->offsets[i],
+                                            list->offsets[i + 1] - list->offsets[i]) != NULL;
+    }
+    ok = ok && topN_select(exact, n, expected, &expectedCount) &&
+         slidingWindow_top(window, n, actual, &actualCount);
+    if (ok && (expectedCount != actualCount ||
+               hashTable_getLength(exact) != slidingWindow_getLength(window) ||
+               end - (size_t)firstTick * wordsPerTick != slidingWindow_getTotal(window))) {
+        printf("Window holds %zu words (%llu total), recount %zu (%zu total)\n",
+               slidingWindow_getLength(window), (unsigned long long)slidingWindow_getTotal(window),
+               hashTable_getLength(exact), end - (size_t)firstTick * wordsPerTick);
+        ok = false;
+    }
+    for (size_t i = 0; ok && i < expectedCount; i++) {
+        if (strcmp(expected[i].word, actual[i].word) != 0 || expected[i].count != actual[i].count) {
+            printf("Rank %zu: window '%s' %llu, recount '%s' %llu\n", i + 1, actual[i].word,
+                   (unsigned long long)actual[i].count, expected[i].word, (unsigned long long)expected[i].count);
+            ok = false;
+        }
+    }
+    free(expected);
+    free(actual);
+    hashTable_destroy(exact);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    size_t n = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : 10;
+    size_t wordsPerTick = (argc > 3) ? (size_t)strtoull(argv[3], NULL, 10) : 10000;
+    wordList list = { 0 };
+
+    if (n == 0) {
+        n = 1;
+    }
+    if (wordsPerTick < QUERIES_PER_TICK) {
+        wordsPerTick = QUERIES_PER_TICK;
+    }
+    if (!wordList_load(path, &list) || list.count == 0) {
+        printf("Error preparing benchmark input\n");
+        wordList_free(&list);
+        return 1;
+    }
+
+    slidingWindow_config config = { WINDOW_BUCKETS, 1, n };
+    slidingWindow *window = slidingWindow_create(&config);
+    WordCount *top = malloc(n * sizeof(WordCount));
+    bool ok = window != NULL && top != NULL;
+
+    size_t queryEvery = wordsPerTick / QUERIES_PER_TICK;
+    size_t queries = 0;
+    double queryTime = 0.0;
+    double maxQuery = 0.0;
+    double addTime = 0.0;
+    double start = stats_now();
+    for (size_t i = 0; ok && i < list.count; i++) {
+        ok = slidingWindow_add(window, list.bytes + list.offsets[i], list.offsets[i + 1] - list.offsets[i],
+                               (uint64_t)(i / wordsPerTick));
+        if (ok && (i + 1) % queryEvery == 0) {
+            size_t selected = 0;
+            double queryStart = stats_now();
+            ok = slidingWindow_top(window, n, top, &selected);
+            double elapsed = stats_now() - queryStart;
+            queryTime += elapsed;
+            maxQuery = (elapsed > maxQuery) ? elapsed : maxQuery;
+            queries++;
+        }
+        if (ok && i + 1 == list.count / 2) {
+            addTime += stats_now() - start;
+            ok = checkWindow(window, &list, i + 1, wordsPerTick, n);
+            start = stats_now();
+        }
+    }
+    addTime += stats_now() - start - queryTime;
+    ok = ok && checkWindow(window, &list, list.count, wordsPerTick, n);
+
+    if (window != NULL) {
+        printf("%-10s %10s %10s %10s %12s %12s %12s\n", "words", "ticks", "distinct", "Madd/s",
+               "queries", "meanQuery_us", "maxQuery_us");
+        printf("%-10zu %10zu %10zu %10.2f %12zu %12.2f %12.2f\n", list.count, list.count / wordsPerTick,
+               slidingWindow_getLength(window), (double)list.count / addTime / 1e6, queries,
+               queries > 0 ? queryTime / (double)queries * 1e6 : 0.0, maxQuery * 1e6);
+    }
+    if (!ok) {
+        printf("FAILED\n");
+    }
+
+    slidingWindow_destroy(window);
+    free(top);
+    wordList_free(&list);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+/*
+ * stopwords benchmark - perfect hash filter in the scanner vs. filtering through a hash table
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Usage: stopwordsBench [text file] [passes]
+ *
+ * The text file is read into memory and its words counted into a fresh
+ * table, as find_frequent_words() does, in three ways:
+ *   - none:         every word hashed and counted
+ *   - perfect hash: stopwords_builtin set on the scanner, stopwords are
+ *                   dropped before they are hashed
+ *   - hash table:   every word looked up in a table of the stopwords, the
+ *                   others counted (the filter a caller would write itself)
+ * The best time of the passes is reported in million words per second, with
+ * the share of words that are stopwords. The words of cfg/stopwords.txt
+ * (run from the repository root) are the reference: both filters must agree
+ * with it on every word of the text, and stopwords_load() of the list must
+ * rebuild exactly the generated table. Any difference fails the benchmark.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashTable.h"
+#include "stats.h"
+#include "stopwords.h"
+#include "wordScanner.h"
+
+// List the built-in table is generated from
+#define STOPWORDS_BENCH_LIST "cfg/stopwords.txt"
+
+// Counting table with the stopword table of the hash table filter
+typedef struct {
+    hashTable *freqMap;     // counts of the words kept
+    hashTable *stopTable;   // stopwords, NULL to keep every word
+} countContext;
+
+// Agreement of the filters with the reference, word by word
+typedef struct {
+    hashTable *reference;   // words of the stopword list
+    const stopwords *loaded;// filter built at run time from the list
+    uint64_t words;         // words checked
+    uint64_t stopwords;     // words of the list among them
+    uint64_t mismatches;    // words some filter got wrong
+} checkContext;
+
+static char *readFile(const char *path, size_t *length) {
+    FILE *fptr = fopen(path, "rb");
+    if (fptr == NULL) {
+        printf("Error opening file %s\n", path);
+        return NULL;
+    }
+    size_t capacity = 1 << 20;
+    char *data = (char *)malloc(capacity);
+    size_t got;
+    *length = 0;
+    while (data != NULL && (got = fread(data + *length, 1, capacity - *length, fptr)) > 0) {
+        *length += got;
+        if (*length == capacity) {
+            capacity *= 2;
+            char *grown = (char *)realloc(data, capacity);
+            if (grown == NULL) {
+                free(data);
+            }
+            data = grown;
+        }
+    }
+    fclose(fptr);
+    return data;
+}
+
+static bool addStopword(const char *word, size_t length, void *context) {
+    uint64_t zero = 0;
+    return hashTable_findOrInsertLen((hashTable *)context, word, length, &zero) != NULL;
+}
+
+static bool countHashed(const char *word, size_t length, uint64_t hash, void *context) {
+    countContext *count = (countContext *)context;
+    return hashTable_incrementOrInsertHashed(count->freqMap, word, length, (size_t)hash) != NULL;
+}
+
+static bool countUnlisted(const char *word, size_t length, void *context) {
+    countContext *count = (countContext *)context;
+    if (hashTable_lookupLen(count->stopTable, word, length) != NULL) {
+        return true;
+    }
+    return hashTable_incrementOrInsertLen(count->freqMap, word, length) != NULL;
+}
+
+static bool checkWord(const char *word, size_t length, void *context) {
+    checkContext *check = (checkContext *)context;
+    bool listed = hashTable_lookupLen(check->reference, word, length) != NULL;
+    check->words++;
+    check->stopwords += listed;
+    if (stopwords_contains(&stopwords_builtin, word, length) != listed ||
+        stopwords_contains(check->loaded, word, length) != listed) {
+        if (check->mismatches++ < 10) {
+            printf("Mismatch on '%.*s' (listed: %d)\n", (int)length, word, listed);
+        }
+    }
+    return true;
+}
+
+static bool scanText(wordScanner *scanner, const char *data, size_t length) {
+    bool ok = wordScanner_feed(scanner, data, length) && wordScanner_finish(scanner);
+    wordScanner_destroy(scanner);
+    return ok;
+}
+
+// mode 0: no filter, 1: perfect hash in the scanner, 2: hash table lookup
+static double timeCounting(int mode, const char *data, size_t length, hashTable *stopTable, size_t *distinct) {
+    hashTable_config config = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, true };
+    countContext count = { hashTable_create(&config), (mode == 2) ? stopTable : NULL };
+    if (count.freqMap == NULL) {
+        return -1.0;
+    }
+    wordScanner scanner;
+    if (mode == 2) {
+        wordScanner_init(&scanner, countUnlisted, &count);
+    } else {
+        wordScanner_initHashed(&scanner, countHashed, count.freqMap->hash_function, count.freqMap->hash_seed, &count);
+        wordScanner_setFilter(&scanner, (mode == 1) ? &stopwords_builtin : NULL);
+    }
+    double start = stats_now();
+    bool ok = scanText(&scanner, data, length);
+    double elapsed = stats_now() - start;
+    *distinct = hashTable_getLength(count.freqMap);
+    hashTable_destroy(count.freqMap);
+    return ok ? elapsed : -1.0;
+}
+
+// The run-time build follows the generator step by step, so the tables are equal
+static bool sameTable(const stopwords *a, const stopwords *b) {
+    return a->count == b->count && a->bucket_count == b->bucket_count && a->seed == b->seed &&
+           a->lengths == b->lengths &&
+           memcmp(a->keys, b->keys, a->count * sizeof(stopwords_key)) == 0 &&
+           memcmp(a->displacements, b->displacements, a->bucket_count * sizeof(uint32_t)) == 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = (argc > 1) ? argv[1] : "shakespeare.txt";
+    int passes = (argc > 2) ? atoi(argv[2]) : 5;
+    size_t textLength = 0;
+    size_t listLength = 0;
+    char *text = readFile(path, &textLength);
+    char *list = readFile(STOPWORDS_BENCH_LIST, &listLength);
+    hashTable_config config = { 0, 0.0, false, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, true };
+    hashTable *stopTable = hashTable_create(&config);
+    stopwords *loaded = stopwords_load(STOPWORDS_BENCH_LIST);
+
+    if (passes <= 0) {
+        passes = 1;
+    }
+    wordScanner scanner;
+    wordScanner_init(&scanner, addStopword, stopTable);
+    if (text == NULL || list == NULL || stopTable == NULL || loaded == NULL ||
+        !scanText(&scanner, list, listLength)) {
+        printf("Error preparing benchmark input\n");
+        free(text);
+        free(list);
+        hashTable_destroy(stopTable);
+        stopwords_destroy(loaded);
+        return 1;
+    }
+
+    checkContext check = { stopTable, loaded, 0, 0, 0 };
+    wordScanner_init(&scanner, checkWord, &check);
+    bool ok = scanText(&scanner, text, textLength) && check.mismatches == 0;
+    bool same = sameTable(&stopwords_builtin, loaded);
+    printf("%s: %llu words, %.1f%% stopwords (%zu listed), run-time table %s the generated one\n", path,
+           (unsigned long long)check.words, check.words > 0 ? 100.0 * (double)check.stopwords / (double)check.words : 0.0,
+           stopwords_builtin.count, same ? "equals" : "DIFFERS from");
+    ok = ok && same;
+
+    const char *labels[] = { "none", "perfect hash", "hash table" };
+    double best[3] = { 0.0, 0.0, 0.0 };
+    size_t distinct[3] = { 0, 0, 0 };
+    for (int pass = 0; ok && pass < passes; pass++) {
+        for (int mode = 0; ok && mode < 3; mode++) {
+            double elapsed = timeCounting(mode, text, textLength, stopTable, &distinct[mode]);
+            ok = elapsed >= 0.0;
+            best[mode] = (pass == 0 || elapsed < best[mode]) ? elapsed : best[mode];
+        }
+    }
+    ok = ok && distinct[1] == distinct[2];
+
+    printf("%-14s %10s %12s %9s\n", "filter", "distinct", "Mwords/s", "speedup");
+    for (int mode = 0; ok && mode < 3; mode++) {
+        printf("%-14s %10zu %12.2f %8.2fx\n", labels[mode], distinct[mode],
+               (double)check.words / best[mode] / 1e6, best[0] / best[mode]);
+    }
+    if (!ok) {
+        printf("FAILED\n");
+    }
+
+    free(text);
+    free(list);
+    hashTable_destroy(stopTable);
+    stopwords_destroy(loaded);
+    return ok ? 0 : 1;
+}
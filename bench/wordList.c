@@ -0,0 +1,60 @@
+/*
+ * word list - the cleaned words of a text, held in memory for benchmarks
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fileReader.h"
+#include "wordScanner.h"
+#include "wordList.h"
+
+static bool appendWord(const char *word, size_t length, void *context) {
+    wordList *list = (wordList *)context;
+    if (list->count + 1 >= list->capacity) {
+        size_t newCapacity = (list->capacity == 0) ? 4096 : list->capacity * 2;
+        size_t *grown = realloc(list->offsets, newCapacity * sizeof(size_t));
+        if (grown == NULL) {
+            return false;
+        }
+        list->offsets = grown;
+        list->capacity = newCapacity;
+    }
+    if (list->bytesUsed + length > list->bytesCapacity) {
+        size_t newCapacity = (list->bytesCapacity == 0) ? 65536 : list->bytesCapacity * 2;
+        while (newCapacity < list->bytesUsed + length) {
+            newCapacity *= 2;
+        }
+        char *grown = realloc(list->bytes, newCapacity);
+        if (grown == NULL) {
+            return false;
+        }
+        list->bytes = grown;
+        list->bytesCapacity = newCapacity;
+    }
+    memcpy(list->bytes + list->bytesUsed, word, length);
+    list->offsets[list->count++] = list->bytesUsed;
+    list->bytesUsed += length;
+    list->offsets[list->count] = list->bytesUsed;
+    return true;
+}
+
+bool wordList_load(const char *path, wordList *list) {
+    wordScanner scanner;
+    wordScanner_init(&scanner, appendWord, list);
+    bool ok = fileReader_scanFile(path, &scanner);
+    wordScanner_destroy(&scanner);
+    if (!ok) {
+        printf("Error reading file %s\n", path);
+    }
+    return ok;
+}
+
+void wordList_free(wordList *list) {
+    free(list->bytes);
+    free(list->offsets);
+    memset(list, 0, sizeof(wordList));
+}
@@ -0,0 +1,38 @@
+/*
+ * word list - the cleaned words of a text, held in memory for benchmarks
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef WORD_LIST_H
+#define WORD_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Every word of a text back to back, word i is bytes[offsets[i], offsets[i + 1])
+typedef struct {
+    char *bytes;        // every word, back to back
+    size_t *offsets;    // start of word i, count + 1 entries
+    size_t count;       // number of words
+    size_t bytesUsed;   // bytes of words stored
+    size_t capacity;    // words that fit in offsets
+    size_t bytesCapacity; // bytes that fit in bytes
+} wordList;
+
+/**
+ * Appends the cleaned words of a file to a list
+ * @param path File to read, as find_frequent_words() reads it
+ * @param list Zero-initialized list, or one already loaded
+ * @return true on success, false (after printing an error) if the file
+ *         cannot be read or memory ran out
+ */
+bool wordList_load(const char *path, wordList *list);
+
+/**
+ * Frees the words of a list
+ * @param list List to free, left empty
+ */
+void wordList_free(wordList *list);
+
+#endif // WORD_LIST_H
@@ -0,0 +1,4 @@
+// Can be overridden at compile time
+#ifndef ARENA_DEFAULT_BLOCK_SIZE
+#define ARENA_DEFAULT_BLOCK_SIZE (1024 * 1024)
+#endif
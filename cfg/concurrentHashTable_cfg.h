@@ -0,0 +1,14 @@
+// Can be overridden at compile time
+#ifndef CONCURRENTHASHTABLE_DEFAULT_CAPACITY
+#define CONCURRENTHASHTABLE_DEFAULT_CAPACITY (1024)
+#endif
+
+// Plain linear probing, kept sparser than hashTable's Robin Hood probing
+#ifndef CONCURRENTHASHTABLE_DEFAULT_MAX_LOAD_FACTOR
+#define CONCURRENTHASHTABLE_DEFAULT_MAX_LOAD_FACTOR (0.5)
+#endif
+
+// Slots a thread claims at a time when helping a resize
+#ifndef CONCURRENTHASHTABLE_MIGRATION_CHUNK
+#define CONCURRENTHASHTABLE_MIGRATION_CHUNK (1024)
+#endif
@@ -0,0 +1,4 @@
+// Can be overridden at compile time
+#ifndef FILEREADER_BUFFER_SIZE
+#define FILEREADER_BUFFER_SIZE (1024 * 1024)
+#endif
@@ -5,4 +5,35 @@
 
 #ifndef HASHTABLE_DEFAULT_MAX_LOAD_FACTOR
 #define HASHTABLE_DEFAULT_MAX_LOAD_FACTOR (0.75)
-#endif
\ No newline at end of file
+#endif
+
+#ifndef HASHTABLE_DEFAULT_USE_ARENA
+#define HASHTABLE_DEFAULT_USE_ARENA (0)
+#endif
+
+// Bytes of each value stored inline in its slot, 0 keeps void* values
+#ifndef HASHTABLE_DEFAULT_VALUE_SIZE
+#define HASHTABLE_DEFAULT_VALUE_SIZE (0)
+#endif
+
+// Hash function of tables created without one (see hashFunctions.h)
+#ifndef HASHTABLE_DEFAULT_HASH_FUNCTION
+#define HASHTABLE_DEFAULT_HASH_FUNCTION (HASH_FUNCTION_WYHASH)
+#endif
+
+// Seed every table randomly, so colliding keys cannot be prepared in advance
+#ifndef HASHTABLE_DEFAULT_RANDOM_SEED
+#define HASHTABLE_DEFAULT_RANDOM_SEED (0)
+#endif
+
+// Store keys in their slot instead of a separate allocation (see inline_keys)
+#ifndef HASHTABLE_DEFAULT_INLINE_KEYS
+#define HASHTABLE_DEFAULT_INLINE_KEYS (0)
+#endif
+
+// Bytes of key kept in the slot of an inline_keys table, null terminator
+// included: shorter keys live in the slot, longer ones are allocated apart.
+// A multiple of 8, keys are compared a 64-bit word at a time
+#ifndef HASHTABLE_INLINE_KEY_SIZE
+#define HASHTABLE_INLINE_KEY_SIZE (16)
+#endif
@@ -0,0 +1,24 @@
+// Can be overridden at compile time
+#ifndef MFW_DEFAULT_THREAD_COUNT
+#define MFW_DEFAULT_THREAD_COUNT (1)
+#endif
+
+// Smallest chunk handed to a counting thread, smaller files use fewer threads
+#ifndef MFW_MIN_CHUNK_SIZE
+#define MFW_MIN_CHUNK_SIZE (64 * 1024)
+#endif
+
+// Word tables carve keys and counters from arena blocks instead of one malloc each
+#ifndef MFW_USE_ARENA
+#define MFW_USE_ARENA (1)
+#endif
+
+// Arena block size of the word tables, 0 for the arena default
+#ifndef MFW_ARENA_BLOCK_SIZE
+#define MFW_ARENA_BLOCK_SIZE (0)
+#endif
+
+// Word tables keep short words in their slots, so a lookup does not chase a key pointer
+#ifndef MFW_INLINE_KEYS
+#define MFW_INLINE_KEYS (1)
+#endif
@@ -0,0 +1,15 @@
+// Can be overridden at compile time
+// Longest n-gram counted, in words
+#ifndef NGRAMCOUNTER_MAX_SIZE
+#define NGRAMCOUNTER_MAX_SIZE (8)
+#endif
+
+// Slots of the n-gram table when it is created
+#ifndef NGRAMCOUNTER_DEFAULT_CAPACITY
+#define NGRAMCOUNTER_DEFAULT_CAPACITY (1024)
+#endif
+
+// Load factor at which the n-gram table doubles
+#ifndef NGRAMCOUNTER_MAX_LOAD_FACTOR
+#define NGRAMCOUNTER_MAX_LOAD_FACTOR (0.7)
+#endif
@@ -0,0 +1,16 @@
+// Can be overridden at compile time
+// Words counted fewer times than this are ranked by a counting sort, one
+// bucket per count; the few counted more often are sorted by comparison
+#ifndef RANKDUMP_COUNT_BUCKETS
+#define RANKDUMP_COUNT_BUCKETS (4096)
+#endif
+
+// Words of equal count are ordered by insertion sort below this many
+#ifndef RANKDUMP_INSERTION_SORT
+#define RANKDUMP_INSERTION_SORT (16)
+#endif
+
+// Bytes of output gathered before each write to the dump file
+#ifndef RANKDUMP_WRITE_BUFFER
+#define RANKDUMP_WRITE_BUFFER (1 << 20)
+#endif
@@ -0,0 +1,15 @@
+// Can be overridden at compile time
+// Buckets of a window created without a bucket count
+#ifndef SLIDINGWINDOW_DEFAULT_BUCKET_COUNT
+#define SLIDINGWINDOW_DEFAULT_BUCKET_COUNT (60)
+#endif
+
+// Time units covered by each bucket of a window created without a width
+#ifndef SLIDINGWINDOW_DEFAULT_BUCKET_WIDTH
+#define SLIDINGWINDOW_DEFAULT_BUCKET_WIDTH (5)
+#endif
+
+// Words ranked incrementally by a window created without a top capacity
+#ifndef SLIDINGWINDOW_DEFAULT_TOP_CAPACITY
+#define SLIDINGWINDOW_DEFAULT_TOP_CAPACITY (100)
+#endif
@@ -0,0 +1,20 @@
+// Can be overridden at compile time
+// Memory budget of a summary created without one, in bytes
+#ifndef SPACESAVING_DEFAULT_MEMORY_BUDGET
+#define SPACESAVING_DEFAULT_MEMORY_BUDGET (16 * 1024 * 1024)
+#endif
+
+// Average key length assumed when turning the budget into a number of counters
+#ifndef SPACESAVING_KEY_BYTES_ESTIMATE
+#define SPACESAVING_KEY_BYTES_ESTIMATE (16)
+#endif
+
+// Rows of the Count-Min sketch, the estimate fails with probability e^-depth
+#ifndef SPACESAVING_SKETCH_DEPTH
+#define SPACESAVING_SKETCH_DEPTH (4)
+#endif
+
+// Part of the budget given to the sketch when enabled, 1/SPACESAVING_SKETCH_SHARE
+#ifndef SPACESAVING_SKETCH_SHARE
+#define SPACESAVING_SKETCH_SHARE (4)
+#endif
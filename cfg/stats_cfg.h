@@ -0,0 +1,5 @@
+// Can be overridden at compile time
+// Build the instrumentation in (make stats-build), 0 compiles every probe to nothing
+#ifndef STATS_ENABLED
+#define STATS_ENABLED (0)
+#endif
@@ -0,0 +1,16 @@
+// Can be overridden at compile time
+// Words per bucket of the perfect hash, on average: fewer buckets take
+// less memory, more buckets find their displacements sooner
+#ifndef STOPWORDS_BUCKET_SIZE
+#define STOPWORDS_BUCKET_SIZE (4)
+#endif
+
+// Displacements tried for a bucket before the hash seed is changed
+#ifndef STOPWORDS_MAX_DISPLACEMENT
+#define STOPWORDS_MAX_DISPLACEMENT (1u << 20)
+#endif
+
+// Hash seeds tried before building a filter fails
+#ifndef STOPWORDS_MAX_ATTEMPTS
+#define STOPWORDS_MAX_ATTEMPTS (64)
+#endif
@@ -0,0 +1,14 @@
+// Can be overridden at compile time
+#ifndef STREAMREADER_BUFFER_SIZE
+#define STREAMREADER_BUFFER_SIZE (1024 * 1024)
+#endif
+
+// Inflate gzip input with zlib, set by the Makefile when zlib is installed (make ZLIB=0 to leave it out)
+#ifndef ZLIB_ENABLED
+#define ZLIB_ENABLED (0)
+#endif
+
+// Buffers in the ring between the reader thread and the scanner
+#ifndef STREAMREADER_RING_SIZE
+#define STREAMREADER_RING_SIZE (4)
+#endif
@@ -0,0 +1,6 @@
+// Can be overridden at compile time
+// The size-n heap is used while n <= vocabulary / TOPN_HEAP_MAX_FRACTION,
+// larger requests fall back to a partial quickselect over the vocabulary
+#ifndef TOPN_HEAP_MAX_FRACTION
+#define TOPN_HEAP_MAX_FRACTION (8)
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Most Frequent Words - Arena (bump) allocator
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// One contiguous block of arena memory
+typedef struct arena_block {
+    struct arena_block* next;   // previously filled block
+    size_t size;                // usable bytes in data
+    size_t used;                // bytes already handed out
+    unsigned char data[];       // block memory
+} arena_block;
+
+// Arena structure - allocations are only released all at once
+typedef struct arena {
+    arena_block* head;          // block currently being filled
+    size_t block_size;          // size of newly allocated blocks
+    size_t bytes_used;          // total bytes handed out
+    size_t bytes_reserved;      // total bytes of all blocks
+} arena;
+
+/**
+ * Creates a new, empty arena
+ * 
+ * @param blockSize Size in bytes of each block, 0 to use ARENA_DEFAULT_BLOCK_SIZE
+ * 
+ * @return Pointer to the new arena on success, NULL on allocation failure
+ * 
+ * @note No block is allocated until the first arena_alloc() call
+ */
+arena* arena_create(size_t blockSize);
+
+/**
+ * Frees every block of the arena and the arena itself
+ * 
+ * @param a Pointer to the arena to destroy. Can be NULL (no-op).
+ * 
+ * @warning Every pointer returned by arena_alloc() becomes invalid
+ */
+void arena_destroy(arena* a);
+
+/**
+ * Allocates memory from the arena
+ * 
+ * @param a Pointer to the arena
+ * @param size Number of bytes to allocate
+ * @param alignment Required alignment, a power of two (1 for strings)
+ * 
+ * @return Pointer to the allocated memory on success, NULL on allocation failure
+ * 
+ * @note Requests larger than the block size get a block of their own
+ * @note The memory is released by arena_destroy(), never individually
+ */
+void* arena_alloc(arena* a, size_t size, size_t alignment);
+
+/**
+ * Copies length bytes into the arena and appends a null terminator
+ * 
+ * @param a Pointer to the arena
+ * @param str Bytes to copy, need not be null-terminated
+ * @param length Number of bytes to copy
+ * 
+ * @return Pointer to the null-terminated copy, NULL on allocation failure
+ */
+char* arena_strndup(arena* a, const char* str, size_t length);
+
+/**
+ * Returns the bytes the arena holds from the system
+ * 
+ * @param a Pointer to the arena. Can be NULL (0).
+ * 
+ * @return Total size of all its blocks, used or not
+ */
+size_t arena_getBytesReserved(const arena* a);
+
+#endif /* ARENA_H */
@@ -0,0 +1,78 @@
+/*
+ * Most Frequent Words - Byte classification kernels
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef CHAR_CLASS_H
+#define CHAR_CLASS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Number of bytes classified by one kernel call
+#define CHARCLASS_BLOCK_SIZE (64)
+
+// Classes of the bytes of one block, bit i describes byte i
+typedef struct {
+    uint64_t whitespace;    // isspace() in the C locale, plus NUL: word boundaries
+    uint64_t punctuation;   // ispunct() in the C locale: removed from words
+    uint64_t uppercase;     // 'A'..'Z': lowercased in words
+    uint64_t nonAscii;      // 0x80..0xFF: UTF-8, cleaned a code point at a time
+} charClass_masks;
+
+// Whitespace as classified by isspace() in the C locale, plus NUL
+static inline bool charClass_isWhitespace(unsigned char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r') || c == '\0';
+}
+
+// Punctuation as classified by ispunct() in the C locale
+static inline bool charClass_isPunctuation(unsigned char c) {
+    return (c >= '!' && c <= '/') || (c >= ':' && c <= '@') ||
+           (c >= '[' && c <= '`') || (c >= '{' && c <= '~');
+}
+
+// Uppercase letters as classified by isupper() in the C locale
+static inline bool charClass_isUppercase(unsigned char c) {
+    return c >= 'A' && c <= 'Z';
+}
+
+// tolower() in the C locale
+static inline unsigned char charClass_toLower(unsigned char c) {
+    return charClass_isUppercase(c) ? (unsigned char)(c + ('a' - 'A')) : c;
+}
+
+/**
+ * Classify a block of CHARCLASS_BLOCK_SIZE bytes
+ * @param block Bytes to classify, exactly CHARCLASS_BLOCK_SIZE readable bytes
+ * @param masks Receives the class masks of the block
+ */
+void charClass_classifyBlock(const char *block, charClass_masks *masks);
+
+/**
+ * Lowercase a block of CHARCLASS_BLOCK_SIZE bytes like tolower() in the C locale
+ * @param src Bytes to lowercase, exactly CHARCLASS_BLOCK_SIZE readable bytes
+ * @param dst Receives the lowercased bytes, may equal src
+ */
+void charClass_lowercaseBlock(const char *src, char *dst);
+
+/**
+ * Select the kernel used by the functions above
+ *
+ * The best kernel supported by the CPU (avx2, then sse2, then scalar) is
+ * selected at startup. All kernels produce identical results.
+ *
+ * @param name "scalar", "sse2" or "avx2"
+ * @return true if selected, false if unknown or not supported by this CPU/build
+ *
+ * @note Not thread-safe, call it before any thread starts scanning
+ */
+bool charClass_selectKernel(const char *name);
+
+/**
+ * Name of the kernel currently in use
+ * @return "scalar", "sse2" or "avx2"
+ */
+const char *charClass_kernelName(void);
+
+#endif // CHAR_CLASS_H
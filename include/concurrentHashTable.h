@@ -0,0 +1,138 @@
+/*
+ * Most Frequent Words - Concurrent word counting table
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef CONCURRENT_HASH_TABLE_H
+#define CONCURRENT_HASH_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashFunctions.h"
+
+// Configuration for concurrentHashTable_create()
+typedef struct {
+    size_t initial_capacity;    // initial number of slots, 0 for the default
+    double max_load_factor;     // load factor that starts a resize, 0 for the default
+    hashFunctions_algorithm hash_function; // key hash, HASH_FUNCTION_DEFAULT for the compile-time default
+} concurrentHashTable_config;
+
+// Opaque table, see concurrentHashTable_create()
+typedef struct concurrentHashTable concurrentHashTable;
+
+// Walks the words of a table nobody is updating, see concurrentHashTable_initIterator()
+typedef struct {
+    concurrentHashTable *table; // table being iterated
+    size_t current_index;       // index of the next slot to inspect
+} concurrentHashTable_iterator;
+
+/**
+ * Create a table of word counters that many threads can update at once
+ *
+ * Every word is a record holding its key and a 64-bit counter, and the
+ * slots only hold pointers to the records. A new word is published by a
+ * compare-and-swap of an empty slot, and a count is added with an atomic
+ * add on the record, so updates never take a lock. Two threads inserting
+ * the same word race for the same empty slot, the loser finds the winner's
+ * record there and counts into it.
+ *
+ * When the table gets too full, the thread that notices allocates an array
+ * twice as large, and every thread that then needs an empty slot helps move
+ * the records over, a chunk of slots at a time, before trying again.
+ * Records are moved, never copied, so counting an existing word goes on
+ * during a resize. Replaced arrays are only freed with the table, which
+ * at most doubles the memory of the slots.
+ *
+ * @param config Configuration, NULL to use the defaults
+ * @return New table, NULL on allocation failure
+ */
+concurrentHashTable *concurrentHashTable_create(const concurrentHashTable_config *config);
+
+/**
+ * Destroy a table and every word in it
+ * @param table Table to destroy, can be NULL (no-op). No thread may be using it.
+ */
+void concurrentHashTable_destroy(concurrentHashTable *table);
+
+/**
+ * Count one occurrence of a word, inserting it at 1 if absent
+ * @param table Table to update, from any number of threads
+ * @param key The word, null-terminated
+ * @return true on success, false if memory ran out
+ */
+bool concurrentHashTable_incrementOrInsert(concurrentHashTable *table, const char *key);
+
+/**
+ * Count one occurrence of a word given as a (pointer, length) slice
+ * @param table Table to update, from any number of threads
+ * @param key The word bytes (need not be null-terminated), copied on insertion
+ * @param length Length of the word in bytes
+ * @return true on success, false if memory ran out
+ */
+bool concurrentHashTable_incrementOrInsertLen(concurrentHashTable *table, const char *key, size_t length);
+
+/**
+ * Add a number of occurrences of a word, inserting it with that count if absent
+ *
+ * Lets a thread fold in counts it gathered on its own, such as a private
+ * hashTable or a snapshot.
+ *
+ * @param table Table to update, from any number of threads
+ * @param key The word bytes (need not be null-terminated), copied on insertion
+ * @param length Length of the word in bytes
+ * @param amount Occurrences to add
+ * @return true on success, false if memory ran out
+ */
+bool concurrentHashTable_addOrInsertLen(concurrentHashTable *table, const char *key, size_t length,
+                                        uint64_t amount);
+
+/**
+ * Count of a word
+ * @param table Table to query, can be updated meanwhile
+ * @param key The word bytes (need not be null-terminated)
+ * @param length Length of the word in bytes
+ * @return Occurrences counted so far, 0 if the word is absent
+ */
+uint64_t concurrentHashTable_count(concurrentHashTable *table, const char *key, size_t length);
+
+/**
+ * Number of distinct words
+ * @param table Table to query, can be updated meanwhile
+ * @return Words inserted so far
+ */
+size_t concurrentHashTable_getLength(concurrentHashTable *table);
+
+/**
+ * Number of slots of the current array
+ * @param table Table to query, can be updated meanwhile
+ * @return Capacity, a power of two
+ */
+size_t concurrentHashTable_getCapacity(concurrentHashTable *table);
+
+/**
+ * Number of times the slots were moved to a larger array
+ * @param table Table to query, can be updated meanwhile
+ * @return Resizes completed so far
+ */
+uint64_t concurrentHashTable_getResizes(concurrentHashTable *table);
+
+/**
+ * Start walking the words of the table
+ * @param table Table to iterate, no thread may update it until the walk ends
+ * @param iter Iterator to initialize
+ */
+void concurrentHashTable_initIterator(concurrentHashTable *table, concurrentHashTable_iterator *iter);
+
+/**
+ * Retrieve the next word and its count
+ * @param iter Iterator initialized by concurrentHashTable_initIterator()
+ * @param key Receives the word, null-terminated and owned by the table
+ * @param count Receives its count
+ * @return true if a word was retrieved, false once every word was seen
+ */
+bool concurrentHashTable_iteratorNext(concurrentHashTable_iterator *iter, const char **key, uint64_t *count);
+
+#endif // CONCURRENT_HASH_TABLE_H
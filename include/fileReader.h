@@ -0,0 +1,82 @@
+/*
+ * Most Frequent Words - File input
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef FILE_READER_H
+#define FILE_READER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "wordScanner.h"
+
+// Paths collected by fileReader_listFiles(), owned by the list
+typedef struct {
+    char **paths;       // file paths, in walk order
+    size_t count;       // number of paths
+    size_t capacity;    // slots allocated in paths
+} fileReader_fileList;
+
+// Read-only view of a whole file mapped into memory
+typedef struct {
+    const char *data;   // file contents, NULL when not mapped
+    size_t length;      // number of bytes in data
+} fileReader_mapping;
+
+/**
+ * Scan every word of a file
+ *
+ * Regular files are memory-mapped and scanned in place, so words reach the
+ * scanner callback without being copied. Pipes, character devices and files
+ * that cannot be mapped are read by streamReader_scanFd() instead, on a
+ * reader thread that overlaps the reads with scanning. So are gzip files,
+ * which the reader thread decompresses as it goes.
+ *
+ * @param path Path to the file to read
+ * @param scanner Initialized scanner receiving the file contents; finished
+ *                (the last word flushed) on success
+ * @return true on success, false if the file could not be opened or read,
+ *         or if the scanner failed
+ */
+bool fileReader_scanFile(const char *path, wordScanner *scanner);
+
+/**
+ * Map a whole regular file read-only into memory
+ * @param path Path to the file to map
+ * @param mapping Receives the mapped contents on success
+ * @return true on success, false if the file cannot be opened, is not a
+ *         non-empty regular file, or mapping is not supported on this platform
+ */
+bool fileReader_map(const char *path, fileReader_mapping *mapping);
+
+/**
+ * Release a mapping created by fileReader_map()
+ * @param mapping Mapping to release, its data is NULL afterwards
+ */
+void fileReader_unmap(fileReader_mapping *mapping);
+
+/**
+ * Expand a set of paths into the files to read
+ *
+ * Directories are walked recursively, their entries visited in name order,
+ * and every regular file found (or symbolic link to one) is listed.
+ * Symbolic links to directories are not followed, so links cannot make the
+ * walk loop. Any other root is listed as given, and so is a directory that
+ * cannot be opened, so that reading it later reports the error.
+ *
+ * @param roots Files and directories to expand
+ * @param rootCount Number of paths in roots
+ * @param list Receives the files, empty on failure
+ * @return true on success, false if memory ran out
+ */
+bool fileReader_listFiles(const char *const *roots, size_t rootCount, fileReader_fileList *list);
+
+/**
+ * Free the paths of a list filled by fileReader_listFiles()
+ * @param list List to free, empty afterwards
+ */
+void fileReader_freeFileList(fileReader_fileList *list);
+
+#endif // FILE_READER_H
@@ -7,42 +7,109 @@
 #ifndef HASHTABLE_H
 #define HASHTABLE_H
 
-// Hash table entry structure - represents a key-value pair
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+#include "hashFunctions.h"
+
+// Hash table entry structure - the header of every slot, the value follows it
+// in the slot: value_size bytes stored inline, or a void* for pointer tables.
+// Tables with inline_keys then keep the bytes of short keys, key points at them
 typedef struct ht_entry{
     const char* key;  // key is NULL if this slot is empty
-    void* value;      // pointer to the value data
-    struct ht_entry* next;   // pointer to the next entry in case of collision (for chaining)
+    size_t hash;      // full hash of the key, compared before the key and reused on resize
+    size_t length;    // length of the key in bytes, excluding the null terminator
 } ht_entry;
 
-// Main hash table structure
+// Counters and shape of a table, see hashTable_getStats()
+typedef struct {
+    uint64_t lookups;           // key searches, including those made by inserts and updates
+    uint64_t hits;              // searches that found their key
+    uint64_t inserts;           // keys added
+    uint64_t deletes;           // keys removed
+    uint64_t probes;            // slots inspected by all searches
+    uint64_t comparisons;       // key byte comparisons (stored hash and length matched)
+    uint64_t resizes;           // times the entries array was doubled
+    size_t length;              // keys stored
+    size_t capacity;            // slots allocated
+    double load_factor;         // length / capacity
+    double mean_probe_length;   // slots a successful lookup inspects, averaged over the keys
+    size_t max_probe_length;    // longest such probe
+} hashTable_stats;
+
+// Main hash table structure (open addressing with Robin Hood linear probing)
 typedef struct hashTable {
-    ht_entry** entries;          // hash slots array
+    unsigned char* entries;     // hash slots array, slot_size bytes per slot
     double max_load_factor;     // maximum load factor before resizing
-    size_t capacity;            // size of entries array
+    size_t capacity;            // number of slots in entries (always a power of two)
     size_t length;              // number of items currently in hash table
+    size_t grow_threshold;      // length at which the entries array is doubled
+    size_t value_size;          // bytes of each inline value, 0 for void* values
+    size_t slot_size;           // bytes of a slot: entry header plus value, 8-byte aligned
+    size_t key_offset;          // offset of the inline key bytes in a slot, 0 without inline_keys
+    unsigned char* scratch;     // two slots of scratch space used while placing entries
+    unsigned int capacity_bits; // log2(capacity), used to map hashes to slots
+    arena* arena;               // owns keys and counters when enabled, NULL otherwise
+    hashFunctions_fn hash_function; // hashes keys, see hashFunctions.h
+    uint64_t hash_seed;         // seed passed to hash_function, 0 unless randomized
+    hashTable_stats stats;      // counters, only updated when built with STATS_ENABLED
 } hashTable;
 
 // Configuration structure for hash table creation
 typedef struct {
     size_t initial_capacity;    // initial number of slots to allocate
     double max_load_factor;     // load factor threshold for resizing
+    bool use_arena;             // carve keys and counters from an arena owned by the table
+    size_t arena_block_size;    // arena block size in bytes, 0 for the arena default
+    size_t value_size;          // bytes of each value stored inline in its slot, 0 for void* values
+    hashFunctions_algorithm hash_function; // key hash, HASH_FUNCTION_DEFAULT for the compile-time default
+    bool random_seed;           // seed the hash randomly against collision flooding
+    bool inline_keys;           // keep keys shorter than HASHTABLE_INLINE_KEY_SIZE in their slot
 } hashTable_config;
 
 //iterator struct 
 typedef struct {
     hashTable* ht;              // pointer to the hash table being iterated
-    size_t current_index;       // current index in the entries array
-    ht_entry* current_entry;    // current entry in the linked list at current index
+    size_t current_index;       // index of the next slot to inspect in the entries array
 } hashTable_iterator;
 
 /**
  * Creates a new hash table with the specified configuration
  * 
- * @param config Pointer to configuration struct containing initial_capacity 
- *               and max_load_factor. Pass NULL to use default values.
+ * @param config Pointer to configuration struct containing initial_capacity,
+ *               max_load_factor and the arena settings. Pass NULL to use
+ *               default values.
  * 
  * @return Pointer to newly created hash table on success, NULL on failure
  * 
+ * @note initial_capacity is rounded up to the next power of two. A zero
+ *       capacity, or a max_load_factor outside (0, 0.95], falls back to the
+ *       default value.
+ * @note The table doubles its capacity whenever inserting would push the
+ *       load factor above max_load_factor.
+ * @note With use_arena set, key copies and the counters created by
+ *       hashTable_incrementOrInsert() are bump-allocated from large blocks
+ *       instead of one malloc() each, and hashTable_destroy() releases them
+ *       a block at a time. Values passed to hashTable_insert() are then left
+ *       to the caller.
+ * @note A non-zero value_size makes an inline table: every value is a copy of
+ *       value_size bytes kept in the key's slot, aligned to 8 bytes. Value
+ *       pointers returned by such a table point into the slots and are only
+ *       valid until the next insertion. With value_size 0 (the default) the
+ *       table stores the void* pointers it is given.
+ * @note hash_function selects the key hash (wyhash unless
+ *       HASHTABLE_DEFAULT_HASH_FUNCTION says otherwise). With random_seed set
+ *       the table draws its own seed, so which keys collide differs between
+ *       tables and runs; iteration order then differs too.
+ * @note With inline_keys set, keys shorter than HASHTABLE_INLINE_KEY_SIZE
+ *       bytes (null terminator included) are copied into their slot, zero
+ *       padded, and compared a 64-bit word at a time: a lookup then reads
+ *       no memory outside the slots it probes. Longer keys are allocated
+ *       apart as usual. Key pointers handed out by such a table (iterator,
+ *       ht_entry) point into the slots and, like inline values, are only
+ *       valid until the next insertion or deletion.
  * @note The caller is responsible for freeing the returned hash table
  *       using hashTable_destroy() when no longer needed.
  * 
@@ -53,6 +120,22 @@ typedef struct {
  *   // Create with custom settings
  *   hashTable_config config = {32, 0.8};
  *   hashTable* ht = hashTable_create(&config);
+ * 
+ *   // Create a table that allocates its keys from 64 KiB arena blocks
+ *   hashTable_config arenaConfig = {32, 0.8, true, 64 * 1024, 0};
+ *   hashTable* arenaHt = hashTable_create(&arenaConfig);
+ * 
+ *   // Create a table of 64-bit counters stored in the slots
+ *   hashTable_config counterConfig = {0, 0.0, true, 0, sizeof(uint64_t)};
+ *   hashTable* counters = hashTable_create(&counterConfig);
+ * 
+ *   // Create a counter table hashed with a randomly seeded FNV-1a
+ *   hashTable_config seededConfig = {0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_FNV1A, true};
+ *   hashTable* seeded = hashTable_create(&seededConfig);
+ * 
+ *   // Create a counter table keeping short keys in the slots
+ *   hashTable_config wordConfig = {0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, true};
+ *   hashTable* words = hashTable_create(&wordConfig);
  */
 hashTable* hashTable_create(hashTable_config* config);
 
@@ -62,7 +145,9 @@ hashTable* hashTable_create(hashTable_config* config);
  * @param ht Pointer to the hash table to destroy. Can be NULL (no-op).
  * 
  * @note This function will:
- *       - Free all key-value pairs stored in the hash table
+ *       - Free all key-value pairs stored in the hash table (or the
+ *         arena blocks holding them, for tables created with use_arena).
+ *         Inline values and inline keys live in the slots and need no freeing.
  *       - Free the entries array
  *       - Free the hash table structure itself
  *       - Set the pointer to NULL is recommended after calling this function
@@ -99,6 +184,24 @@ void hashTable_destroy(hashTable* ht);
  */
 void* hashTable_lookup(hashTable* ht, const char* key);
 
+/**
+ * Looks up a value by a key given as a (pointer, length) slice
+ * 
+ * @param ht Pointer to the hash table
+ * @param key Pointer to the key bytes, need not be null-terminated
+ * @param length Number of bytes in the key
+ * 
+ * @return Pointer to the value associated with the key, or NULL if not found
+ * 
+ * @note Behaves exactly like hashTable_lookup() on the same key bytes, it
+ *       allows looking up words in place inside a larger buffer
+ * 
+ * @example
+ *   const char* line = "hello world";
+ *   void* value = hashTable_lookupLen(ht, line + 6, 5); // looks up "world"
+ */
+void* hashTable_lookupLen(hashTable* ht, const char* key, size_t length);
+
 /**
  * Inserts or updates a key-value pair in the hash table
  * 
@@ -110,6 +213,8 @@ void* hashTable_lookup(hashTable* ht, const char* key);
  * 
  * @note If the key already exists, its value will be updated to the new value
  *       If the key does not exist, a new entry will be created
+ * @note Inline tables copy value_size bytes from value into the slot and
+ *       return a pointer to the copy
  * 
  * @example
  *   hashTable* ht = hashTable_create(NULL);
@@ -132,7 +237,12 @@ void* hashTable_insert(hashTable* ht, const char* key, const void* value);
  * @return Pointer to the incremented integer value on success, NULL on failure
  * 
  * @note If the key does not exist, a new entry will be created with initial value 1
- *       The value associated with the key must be of type int*
+ * @note The counter depends on the table layout. Inline tables with
+ *       value_size == sizeof(uint64_t) keep a uint64_t counter in the slot
+ *       and increment it without any allocation; other inline value sizes
+ *       are rejected (NULL). Tables of void* values (value_size 0) point to
+ *       an int counter allocated with the key, so every value of such a
+ *       table must be an int*.
  * 
  * @example
  *   hashTable* ht = hashTable_create(NULL);
@@ -145,9 +255,175 @@ void* hashTable_insert(hashTable* ht, const char* key, const void* value);
  */
 void* hashTable_incrementOrInsert(hashTable* ht, const char* key);
 
+/**
+ * Increments the integer value of a key given as a (pointer, length) slice
+ * 
+ * @param ht Pointer to the hash table
+ * @param key Pointer to the key bytes, need not be null-terminated
+ * @param length Number of bytes in the key
+ * 
+ * @return Pointer to the incremented integer value on success, NULL on failure
+ * 
+ * @note Behaves exactly like hashTable_incrementOrInsert() on the same key
+ *       bytes. The key bytes are only copied when a new entry is created.
+ * 
+ * @example
+ *   const char* buffer = "to be or not to be";
+ *   int* value = (int*)hashTable_incrementOrInsertLen(ht, buffer + 3, 2); // "be"
+ */
+void* hashTable_incrementOrInsertLen(hashTable* ht, const char* key, size_t length);
+
+/**
+ * Adds to the counter of a key given as a (pointer, length) slice
+ * 
+ * @param ht Pointer to the hash table
+ * @param key Pointer to the key bytes, need not be null-terminated
+ * @param length Number of bytes in the key
+ * @param count Amount added, the counter of a new entry starts from it
+ * 
+ * @return Pointer to the updated uint64_t counter on success, NULL if memory
+ *         ran out or the table does not store uint64_t counters inline
+ * 
+ * @note The bulk form of hashTable_incrementOrInsertLen(), for merging
+ *       counts from another table or a file. The key is hashed and probed
+ *       once, and only copied when a new entry is created.
+ * 
+ * @example
+ *   // merge the counts of src into dst
+ *   while (hashTable_iteratorNext(&iter, &word, &value)) {
+ *       hashTable_addCountLen(dst, word, strlen(word), *(uint64_t*)value);
+ *   }
+ */
+void* hashTable_addCountLen(hashTable* ht, const char* key, size_t length, uint64_t count);
+
+/**
+ * Hashes a key with the table's hash function and seed
+ * 
+ * @param ht Pointer to the hash table
+ * @param key Pointer to the key bytes, need not be null-terminated
+ * @param length Number of bytes in the key
+ * 
+ * @return The hash the table stores and probes with for this key
+ * 
+ * @note ht->hash_function(key, length, ht->hash_seed) gives the same value,
+ *       which lets a tokenizer hash words without holding the table
+ * 
+ * @example
+ *   size_t hash = hashTable_hashKey(ht, "word", 4);
+ */
+size_t hashTable_hashKey(const hashTable* ht, const char* key, size_t length);
+
+/**
+ * Increments the integer value of a key whose hash the caller computed
+ * 
+ * @param ht Pointer to the hash table
+ * @param key Pointer to the key bytes, need not be null-terminated
+ * @param length Number of bytes in the key
+ * @param hash hashTable_hashKey() of the key
+ * 
+ * @return Pointer to the incremented integer value on success, NULL on failure
+ * 
+ * @note Behaves exactly like hashTable_incrementOrInsertLen(), without
+ *       hashing the key again: a caller that produces the key (a tokenizer
+ *       cleaning a word) hashes it while the bytes are at hand
+ * @warning A hash that is not hashTable_hashKey() of the key stores the key
+ *          where no other call finds it
+ * 
+ * @example
+ *   size_t hash = hashTable_hashKey(ht, word, length);
+ *   uint64_t* count = (uint64_t*)hashTable_incrementOrInsertHashed(ht, word, length, hash);
+ */
+void* hashTable_incrementOrInsertHashed(hashTable* ht, const char* key, size_t length, size_t hash);
+
+/**
+ * Updates the value of a key in place, or inserts a default value
+ * 
+ * @param ht Pointer to the hash table
+ * @param key The key string to update or insert
+ * @param defaultValue Value of a new entry, as given to hashTable_insert()
+ * @param updateFunc Called with a pointer to the current value when the key
+ *                   exists (the inline bytes, or the stored void*), together
+ *                   with context
+ * @param context User pointer passed to updateFunc
+ * 
+ * @return Pointer to the updated or inserted value on success, NULL on failure
+ * 
+ * @note The key is hashed and probed once, whichever path is taken
+ * @note Counters are added to with hashTable_addCountLen(), no callback needed
+ * 
+ * @example
+ *   static void keepLatest(void* value, void* context) {
+ *       uint64_t* lastSeen = (uint64_t*)value;
+ *       uint64_t now = *(const uint64_t*)context;
+ *       *lastSeen = (now > *lastSeen) ? now : *lastSeen;
+ *   }
+ * 
+ *   uint64_t now = 5;
+ *   hashTable_updateOrInsert(lastSeen, "word", &now, keepLatest, &now);
+ */
 void* hashTable_updateOrInsert(hashTable* ht, const char* key, 
-                               void* defaultValue, 
-                               void* (*updateFunc)(void* existingValue));
+                               const void* defaultValue, 
+                               void (*updateFunc)(void* existingValue, void* context),
+                               void* context);
+
+/**
+ * Finds the value of a key given by pointer and length, inserting a default value if absent
+ * 
+ * @param ht Pointer to the hash table
+ * @param key The key bytes (need not be null-terminated), copied on insertion
+ * @param length Length of the key in bytes
+ * @param defaultValue Value of a new entry, as given to hashTable_insert()
+ * 
+ * @return Pointer to the existing or inserted value on success, NULL if
+ *         memory ran out
+ * 
+ * @note This is the general form of hashTable_incrementOrInsertLen() for
+ *       inline values of any size: the caller updates the returned value in
+ *       place. It is only valid until the next insertion.
+ * 
+ * @example
+ *   typedef struct { uint64_t count; uint64_t seen; } wordInfo;
+ *   wordInfo none = { 0, 0 };
+ *   wordInfo* info = (wordInfo*)hashTable_findOrInsertLen(ht, line + 4, 3, &none);
+ *   info->count++;
+ */
+void* hashTable_findOrInsertLen(hashTable* ht, const char* key, size_t length, const void* defaultValue);
+
+/**
+ * Removes a key and its value from the hash table
+ * 
+ * The entries that follow the removed one in its probe run are shifted back
+ * one slot (backward shift deletion), so no tombstones are left behind and
+ * lookups stay as short as if the key had never been inserted.
+ * 
+ * @param ht Pointer to the hash table
+ * @param key The key string to remove
+ * 
+ * @return true if the key was found and removed, false if it was not present
+ * 
+ * @note The key copy is freed, and so is a void* value as hashTable_destroy()
+ *       would. With an arena their memory is only reclaimed when the table
+ *       is destroyed.
+ * @note Pointers to inline values of other keys may be invalidated, since
+ *       entries move.
+ * 
+ * @example
+ *   hashTable_delete(ht, "stale");
+ */
+bool hashTable_delete(hashTable* ht, const char* key);
+
+/**
+ * Removes a key given by pointer and length from the hash table
+ * 
+ * @param ht Pointer to the hash table
+ * @param key The key bytes (need not be null-terminated)
+ * @param length Length of the key in bytes
+ * 
+ * @return true if the key was found and removed, false if it was not present
+ * 
+ * @note Behaves like hashTable_delete()
+ */
+bool hashTable_deleteLen(hashTable* ht, const char* key, size_t length);
 
 /**
  * @brief Initializes a hash table iterator to traverse all key-value pairs
@@ -192,7 +468,8 @@ void hashTable_initIterator(hashTable* ht, hashTable_iterator* iter);
  * 
  * @return true if a valid entry was retrieved, false if no more entries exist
  * 
- * @note The returned key and value pointers are valid until the hash table is modified
+ * @note The returned key and value pointers are valid until the hash table is modified,
+ *       keys stored inline (inline_keys) move with their slot
  * @note Do not free or modify the returned key pointer
  * @note The value pointer points to the actual stored data
  * @note Call this function repeatedly until it returns false to traverse all entries
@@ -213,6 +490,29 @@ void hashTable_initIterator(hashTable* ht, hashTable_iterator* iter);
  */
 bool hashTable_iteratorNext(hashTable_iterator* iter, const char** key, void** value);
 
+/**
+ * @brief Returns the entry of an inline value: its key, key length and hash
+ * 
+ * @param ht Pointer to the hash table. Must not be NULL.
+ * @param value Value pointer handed out by this table (lookup, insertion or
+ *              iterator)
+ * 
+ * @return The entry holding value, NULL for tables of void* values, whose
+ *         values live outside the slots
+ * 
+ * @note Lets a caller keep only the value pointer of a word and still get
+ *       its key back, without a second lookup or its own copy of the key
+ * @note Like the value, the entry is only valid until the next insertion or
+ *       deletion. Its key pointer outlives slot moves unless the key is
+ *       stored inline (inline_keys).
+ * 
+ * @example
+ *   uint64_t* count = (uint64_t*)hashTable_incrementOrInsertLen(ht, word, length);
+ *   const ht_entry* entry = hashTable_valueEntry(ht, count);
+ *   printf("%s: %llu\n", entry->key, (unsigned long long)*count);
+ */
+const ht_entry* hashTable_valueEntry(const hashTable* ht, const void* value);
+
 /**
  * @brief Retrieves the number of key-value pairs currently stored in the hash table
  * 
@@ -231,10 +531,73 @@ bool hashTable_iteratorNext(hashTable_iterator* iter, const char** key, void** v
  */
 size_t hashTable_getLength(hashTable* ht);
 
+/**
+ * @brief Returns the heap memory held by the hash table for its keys and values
+ * 
+ * @param ht Pointer to the hash table. Must not be NULL.
+ * 
+ * @return Bytes of the slots array, plus the arena blocks for tables created
+ *         with use_arena
+ * 
+ * @note Keys and values allocated one by one (tables without an arena) are
+ *       not counted, their size is only known to the allocator
+ * 
+ * @example
+ *   printf("table holds %zu KiB\n", hashTable_getMemoryUsage(ht) / 1024);
+ */
+size_t hashTable_getMemoryUsage(const hashTable* ht);
+
+/**
+ * @brief Computes probe length statistics over all keys in the hash table
+ * 
+ * The probe length of a key is the number of slots inspected by a successful
+ * lookup of that key (1 when the key sits in its home slot).
+ * 
+ * @param ht Pointer to the hash table. Must not be NULL.
+ * @param meanProbeLength Pointer to store the mean probe length (0 if empty). Can be NULL.
+ * @param maxProbeLength Pointer to store the longest probe length (0 if empty). Can be NULL.
+ * 
+ * @note This walks the whole entries array, it is meant for diagnostics and
+ *       benchmarks rather than the hot path
+ * 
+ * @example
+ *   double mean;
+ *   size_t max;
+ *   hashTable_getProbeStats(ht, &mean, &max);
+ *   printf("mean probe %.2f, max probe %zu\n", mean, max);
+ */
+void hashTable_getProbeStats(hashTable* ht, double* meanProbeLength, size_t* maxProbeLength);
+
+/**
+ * @brief Retrieves the operation counters and the shape of the hash table
+ * 
+ * The counters (lookups, hits, inserts, deletes, probes, comparisons,
+ * resizes) are only maintained in builds with STATS_ENABLED (see
+ * stats_cfg.h) and read zero otherwise, so the default build pays nothing
+ * for them. The shape
+ * (length, capacity, load factor and probe lengths) is always filled in.
+ * 
+ * Probes per lookup and comparisons per lookup tell how much work each
+ * search does: a well mixed hash keeps both close to 1.
+ * 
+ * @param ht Pointer to the hash table. Must not be NULL.
+ * @param stats Pointer receiving the statistics. Must not be NULL.
+ * 
+ * @note Like hashTable_getProbeStats(), this walks the whole entries array.
+ *       Tables built with STATS_ENABLED report their statistics to the
+ *       stats module when destroyed (see stats.h).
+ * 
+ * @example
+ *   hashTable_stats stats;
+ *   hashTable_getStats(ht, &stats);
+ *   printf("%.2f probes per lookup, load %.2f, %llu resizes\n",
+ *          (double)stats.probes / (double)stats.lookups, stats.load_factor,
+ *          (unsigned long long)stats.resizes);
+ */
+void hashTable_getStats(hashTable* ht, hashTable_stats* stats);
+
 
 #endif /* HASHTABLE_H */
 
 
-// TODO: create hashtable iterator struct 
-// TODO: add functions to initialize and get next key-value pair
 // TODO: review struct documentation following doxygen 
@@ -7,14 +7,270 @@
 #ifndef MOST_FREQUENT_WORDS_H
 #define MOST_FREQUENT_WORDS_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+#include "rankDump.h"
+#include "stopwords.h"
+#include "streamReader.h"
+#include "topN.h"
+
+// Counting engine used by find_frequent_words_ex()
+typedef enum {
+    FREQUENT_WORDS_EXACT = 0,       // hash table of every distinct word
+    FREQUENT_WORDS_SPACE_SAVING     // fixed-memory Space-Saving summary, approximate counts
+} frequentWords_engine;
+
+// Configuration for find_frequent_words_ex()
+typedef struct {
+    size_t thread_count;        // counting threads, 0 or 1 counts on the calling thread
+    frequentWords_engine engine;// exact (default) or approximate counting
+    size_t memory_budget;       // Space-Saving: bytes for counters and sketch, 0 for the default
+    bool use_sketch;            // Space-Saving: back admissions with a Count-Min sketch
+    const char *snapshot_path;  // exact engine: save the counts to this snapshot file, NULL for none
+    size_t ngram_size;          // exact engine: rank runs of this many words, 0 or 1 for single words
+    const char *dump_path;      // exact engine: write the ranking of every word to this file, NULL for none
+    rankDump_format dump_format;// format of the dump file, TSV (default) or binary
+    const stopwords *stopword_filter; // words of the text not counted (not phrases), NULL to count all
+} frequentWords_config;
+
+// A ranked word with bounds on its count: the true count lies in [count - error, count]
+typedef struct {
+    char *word;                 // the word, owned by the array
+    uint64_t count;             // number of occurrences (an upper bound when approximate)
+    uint64_t error;             // maximum overestimation of count, 0 for the exact engine
+} frequentWords_estimate;
+
 /**
  * Find the N most frequent words in a text file
+ *
+ * Files starting with the gzip magic bytes are decompressed on a reader
+ * thread while their words are counted (see streamReader_scanFd()), in every
+ * mode and engine.
+ *
  * @param path Path to the text file
  * @param n Number of top words to return
- * @return Array of strings containing the most frequent words
+ * @return Array of strings containing the most frequent words, terminated by
+ *         NULL (earlier than n entries when the file has fewer distinct words)
  */
 char **find_frequent_words(const char *path, int32_t n);
 
+/**
+ * Find the N most frequent words in a text file with a custom configuration
+ *
+ * With thread_count > 1 the file is memory-mapped, split into chunks aligned
+ * on whitespace and each chunk is counted by its own thread into a private
+ * hash table. The tables are merged before ranking, so the result is the same
+ * as the serial path. Inputs that cannot be mapped (pipes) and gzip files,
+ * which can only be inflated from the start, are counted serially.
+ *
+ * The FREQUENT_WORDS_SPACE_SAVING engine counts on the calling thread into a
+ * summary of fixed size (memory_budget), however large the vocabulary. Every
+ * word occurring more than total / counters times is found, the ranking of
+ * rarer words is approximate. Use find_frequent_words_estimates() to get the
+ * error bound of each word.
+ *
+ * The exact engine also reads snapshot files (see snapshot.h) in place of
+ * text, their counts are taken as they are. With snapshot_path set, the
+ * counts of every word are saved there before ranking, so later runs can
+ * start from them instead of the text. With dump_path set, every word is
+ * ranked and written there with its count, as TSV lines or binary records
+ * (see rankDump.h), for vocabularies and corpus comparisons.
+ *
+ * With stopword_filter set (stopwords_builtin, or a list from
+ * stopwords_load()), the scanner drops those words before they are hashed
+ * or reach a table, by either engine. Counts read from snapshots are taken
+ * as they are.
+ *
+ * With ngram_size > 1 the exact engine ranks phrases of that many
+ * consecutive words instead, returned with their words separated by single
+ * spaces (see ngramCounter.h). Phrases are counted on the calling thread,
+ * and cannot be saved to or read from snapshots.
+ *
+ * @param path Path to the text file
+ * @param n Number of top words to return
+ * @param config Configuration, NULL to use the defaults
+ * @return Array of strings containing the most frequent words
+ */
+char **find_frequent_words_ex(const char *path, int32_t n, const frequentWords_config *config);
+
+// Ranked words and their counts in one block, see find_frequent_words_ranked()
+typedef struct {
+    size_t count;               // words ranked, min(n, distinct words)
+    WordCount words[];          // best ranked first, each word stored in the block after the array
+} frequentWords_ranking;
+
+/**
+ * Find the N most frequent words in a text file, with their counts, in a single allocation
+ *
+ * Works like find_frequent_words_ex() with the same configuration, but the
+ * words are selected as references into the table and copied once, with
+ * their counts, into one block: no allocation per word, and a single
+ * frequentWords_freeRanking() releases it all. Counts of the Space-Saving
+ * engine are upper bounds, see find_frequent_words_estimates() for their
+ * error.
+ *
+ * @param path Path to the text file
+ * @param n Number of top words to return
+ * @param config Configuration, NULL to use the defaults
+ * @return Ranking, NULL on failure. Free it with frequentWords_freeRanking().
+ */
+frequentWords_ranking *find_frequent_words_ranked(const char *path, int32_t n, const frequentWords_config *config);
+
+/**
+ * Free a ranking returned by find_frequent_words_ranked()
+ * @param ranking Ranking to free, can be NULL (no-op)
+ */
+void frequentWords_freeRanking(frequentWords_ranking *ranking);
+
+/**
+ * Find the N most frequent words in a text file, with their counts and error bounds
+ *
+ * @param path Path to the text file
+ * @param n Number of top words to return
+ * @param config Configuration, NULL to use the defaults
+ * @param selected Receives the number of words returned
+ * @return Array of selected words, best ranked first, NULL on failure. Free
+ *         it with frequentWords_freeEstimates().
+ */
+frequentWords_estimate *find_frequent_words_estimates(const char *path, int32_t n,
+                                                      const frequentWords_config *config,
+                                                      size_t *selected);
+
+/**
+ * Find the N most frequent words read from a file descriptor, such as stdin
+ *
+ * The descriptor is read to its end by a reader thread filling a ring of
+ * buffers while the calling thread counts (see streamReader_scanFd()), so
+ * the end of a pipeline (zcat ... | program) needs no temporary file. The
+ * engine setting applies, thread_count does not: a stream is counted by one
+ * thread. So do ngram_size and stopword_filter.
+ *
+ * @param fd Descriptor to read, not closed
+ * @param n Number of top words to return
+ * @param config Configuration, NULL to use the defaults
+ * @param selected Receives the number of words returned
+ * @param stats Receives the throughput and stall counts of the read, can be NULL
+ * @return Array of selected words, best ranked first, NULL on failure. Free
+ *         it with frequentWords_freeEstimates().
+ */
+frequentWords_estimate *find_frequent_words_fd(int fd, int32_t n, const frequentWords_config *config,
+                                               size_t *selected, streamReader_stats *stats);
+
+/**
+ * Free an array returned by find_frequent_words_estimates() or find_frequent_words_fd()
+ * @param estimates Array to free, can be NULL (no-op)
+ * @param count Number of words in the array
+ */
+void frequentWords_freeEstimates(frequentWords_estimate *estimates, size_t count);
+
+// One file of a batch and, when requested, its own ranking
+typedef struct {
+    char *path;                     // file counted, owned by the batch result
+    frequentWords_estimate *top;    // best words of this file alone, NULL unless requested
+    size_t selected;                // number of words in top
+    bool ok;                        // false if the file could not be read
+} frequentWords_fileResult;
+
+// Result of find_frequent_words_batch()
+typedef struct {
+    frequentWords_estimate *top;    // best words over all files, exact counts
+    size_t selected;                // number of words in top
+    frequentWords_fileResult *files;// every file counted, in walk order
+    size_t file_count;              // number of files
+    size_t failed_count;            // files that could not be read
+} frequentWords_batchResult;
+
+/**
+ * Find the N most frequent words over many files and directories
+ *
+ * Directories are walked recursively (see fileReader_listFiles()). Files are
+ * handed out to thread_count workers, each counting whole files into its own
+ * table, and the tables are merged and ranked once at the end, instead of
+ * building and ranking one table per file. Counts are always exact, the
+ * engine and ngram_size settings are ignored.
+ *
+ * Files that cannot be read are reported in the result (ok is false) and
+ * do not stop the batch.
+ *
+ * Snapshot files among the inputs add their counts instead of being
+ * scanned, and snapshot_path saves the merged counts, so a snapshot is
+ * brought up to date with new files by passing it along with them.
+ * dump_path ranks the merged counts into a dump file, and stopword_filter
+ * drops stopwords from the scanned files.
+ *
+ * @param paths Files and directories to count
+ * @param pathCount Number of paths
+ * @param n Number of top words to return over all files
+ * @param perFileN Number of top words to return for each file, 0 for none
+ * @param config Configuration (thread_count), NULL to use the defaults
+ * @return Batch result, NULL on failure. Free it with frequentWords_freeBatch().
+ */
+frequentWords_batchResult *find_frequent_words_batch(const char *const *paths, size_t pathCount,
+                                                     int32_t n, int32_t perFileN,
+                                                     const frequentWords_config *config);
+
+/**
+ * Free a result returned by find_frequent_words_batch()
+ * @param result Result to free, can be NULL (no-op)
+ */
+void frequentWords_freeBatch(frequentWords_batchResult *result);
+
+// Incremental counting session, see frequentWords_createSession()
+typedef struct frequentWords_session frequentWords_session;
+
+/**
+ * Create a session that counts words from a stream of buffers
+ *
+ * Text is pushed with frequentWords_feed() as it arrives, and the ranking can
+ * be queried with frequentWords_top() at any point while feeding continues.
+ * The session is not thread-safe: feeds and queries must not overlap.
+ *
+ * @return New session, NULL on allocation failure
+ */
+frequentWords_session *frequentWords_createSession(void);
+
+/**
+ * Count the words of the next buffer of the stream
+ *
+ * Buffers may split words anywhere: a word touching the end of data is held
+ * back until the following feed (or frequentWords_finish()) completes it.
+ *
+ * @param session Session to feed
+ * @param data Bytes of the stream, not retained after the call
+ * @param length Number of bytes in data
+ * @return true on success, false if memory ran out
+ */
+bool frequentWords_feed(frequentWords_session *session, const char *data, size_t length);
+
+/**
+ * Mark the end of the stream, counting the word held back by the last feed
+ *
+ * Feeding may continue afterwards, the next buffer then starts a new word.
+ *
+ * @param session Session to finish
+ * @return true on success, false if memory ran out
+ */
+bool frequentWords_finish(frequentWords_session *session);
+
+/**
+ * Rank the words counted so far
+ *
+ * The word held back by the last feed is not counted yet. The session is left
+ * untouched, so feeding can go on after the query.
+ *
+ * @param session Session to query
+ * @param n Number of top words to return
+ * @return Array of strings containing the most frequent words, terminated by
+ *         NULL, as returned by find_frequent_words(). NULL on failure.
+ */
+char **frequentWords_top(frequentWords_session *session, int32_t n);
+
+/**
+ * Destroy a session and all its counts
+ * @param session Session to destroy, can be NULL (no-op)
+ */
+void frequentWords_destroySession(frequentWords_session *session);
+
 #endif // MOST_FREQUENT_WORDS_H
\ No newline at end of file
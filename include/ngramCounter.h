@@ -0,0 +1,114 @@
+/*
+ * Most Frequent Words - N-gram counts
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef NGRAM_COUNTER_H
+#define NGRAM_COUNTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "topN.h"
+
+// Opaque counter, see ngramCounter_create()
+typedef struct ngramCounter ngramCounter;
+
+/**
+ * Create a counter of the runs of size consecutive words (bigrams for 2, trigrams for 3)
+ *
+ * Every distinct word gets a 32-bit token id the first time it is seen. An
+ * n-gram is stored as its size token ids, never as a joined string, so
+ * counting a phrase copies no text and its key costs 4 bytes per word.
+ * Each token id carries a 64-bit hash, and the hash of the last size words
+ * is rolled forward as words arrive: the oldest word's term is subtracted
+ * and the newest one's added, so finding the n-gram's slot costs the same
+ * whatever its size. Phrases are only joined for the words ranked by
+ * ngramCounter_top().
+ *
+ * @param size Words per n-gram, from 1 to NGRAMCOUNTER_MAX_SIZE
+ * @return New counter, NULL if size is out of range or on allocation failure
+ */
+ngramCounter *ngramCounter_create(size_t size);
+
+/**
+ * Destroy a counter
+ * @param counter Counter to destroy, can be NULL (no-op)
+ */
+void ngramCounter_destroy(ngramCounter *counter);
+
+/**
+ * Count the n-gram ending with the next word of the text
+ *
+ * Has the signature of wordScanner_callback, so a scanner can feed the
+ * counter directly. Nothing is counted until size words were added.
+ *
+ * @param word The word bytes (need not be null-terminated)
+ * @param length Length of the word in bytes
+ * @param context The counter
+ * @return true on success, false if memory ran out
+ */
+bool ngramCounter_addWord(const char *word, size_t length, void *context);
+
+/**
+ * Forget the last words, so no n-gram spans the end of one text and the start of the next
+ * @param counter Counter to update
+ */
+void ngramCounter_breakSequence(ngramCounter *counter);
+
+/**
+ * Select the n most frequent n-grams
+ *
+ * Ranked like words: count descending, then phrase ascending.
+ *
+ * @param counter Counter to query
+ * @param n Number of n-grams to select
+ * @param result Array of at least n slots, receives the phrases in ranking
+ *               order, their words separated by single spaces. The phrases
+ *               are owned by the counter and only valid until the next call
+ *               or until it is destroyed.
+ * @param selected Receives the number of phrases written
+ * @return true on success, false if memory ran out
+ */
+bool ngramCounter_top(ngramCounter *counter, size_t n, WordCount *result, size_t *selected);
+
+/**
+ * Count of a phrase
+ * @param counter Counter to query
+ * @param phrase The words of the n-gram separated by single spaces (need not be null-terminated)
+ * @param length Length of the phrase in bytes
+ * @return Occurrences of the phrase, 0 if it was never counted
+ */
+uint64_t ngramCounter_count(ngramCounter *counter, const char *phrase, size_t length);
+
+/**
+ * Number of distinct n-grams
+ * @param counter Counter to query
+ * @return N-grams counted at least once
+ */
+size_t ngramCounter_getLength(ngramCounter *counter);
+
+/**
+ * Number of n-grams counted
+ * @param counter Counter to query
+ * @return Sum of every count
+ */
+uint64_t ngramCounter_getTotal(ngramCounter *counter);
+
+/**
+ * Number of distinct words
+ * @param counter Counter to query
+ * @return Token ids handed out
+ */
+size_t ngramCounter_getTokenCount(ngramCounter *counter);
+
+/**
+ * Bytes held by the counter: slots, token ids of the n-grams, and the word table
+ * @param counter Counter to query
+ * @return Heap memory in bytes
+ */
+size_t ngramCounter_getMemory(ngramCounter *counter);
+
+#endif // NGRAM_COUNTER_H
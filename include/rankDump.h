@@ -0,0 +1,92 @@
+/*
+ * Most Frequent Words - Ranking of a whole vocabulary
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef RANK_DUMP_H
+#define RANK_DUMP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashTable.h"
+
+// First bytes of every binary dump file
+#define RANKDUMP_MAGIC "MFWRANK1"
+// Binary format version written by this code
+#define RANKDUMP_VERSION (1u)
+
+// Output formats of rankDump_writeTable()
+typedef enum {
+    RANKDUMP_TSV = 0,           // one "word<TAB>count" line per word
+    RANKDUMP_BINARY             // rankDump_header, then one record per word
+} rankDump_format;
+
+/*
+ * Binary layout, every field in native byte order (byte_order tells it apart):
+ *
+ *   rankDump_header                          48 bytes
+ *   word_count records, in ranking order:
+ *     uint64_t count
+ *     uint32_t length                        bytes of the word
+ *     char word[length]                      not null-terminated
+ *
+ * Records are packed back to back, so they are read in sequence.
+ */
+typedef struct {
+    char magic[8];              // RANKDUMP_MAGIC, not null-terminated
+    uint32_t version;           // RANKDUMP_VERSION
+    uint32_t byte_order;        // 0x01020304 as written by the producing machine
+    uint64_t word_count;        // distinct words, records that follow
+    uint64_t total_count;       // sum of all counts
+    uint64_t reserved[2];       // zero
+} rankDump_header;
+
+/**
+ * Called once per word, in ranking order
+ * @param word The word, owned by the table (null-terminated)
+ * @param length Number of bytes in the word
+ * @param count Its count
+ * @param context User pointer given to rankDump_rankTable()
+ * @return true to go on, false to stop
+ */
+typedef bool (*rankDump_callback)(const char *word, size_t length, uint64_t count, void *context);
+
+/**
+ * Rank every word of a frequency table
+ *
+ * The order is the one of cmpWordCount(): count descending, then word
+ * ascending (strcmp). Words counted fewer than RANKDUMP_COUNT_BUCKETS times,
+ * nearly the whole vocabulary of a text, are put in place by a counting sort
+ * on their count; only the words sharing a count are then ordered, by a
+ * radix (multikey) quicksort on their bytes. The rarer high counts are
+ * sorted by comparison. Words are referenced in the table, never copied:
+ * the ranking costs their entry, count and first 8 bytes, 24 bytes a word.
+ *
+ * @param freqMap Table mapping words to uint64_t counts stored inline
+ *                (value_size == sizeof(uint64_t)), not modified while ranking
+ * @param callback Receives every word in ranking order
+ * @param context User pointer passed to callback
+ * @return true once every word was passed, false if memory ran out, the
+ *         counts are not stored inline or the callback stopped
+ */
+bool rankDump_rankTable(hashTable *freqMap, rankDump_callback callback, void *context);
+
+/**
+ * Write the ranking of every word of a frequency table to a file
+ *
+ * Words are written as they are ranked, no array of strings is built. The
+ * file is written next to path under a temporary name and renamed over path
+ * once complete, so readers never see a partial dump.
+ *
+ * @param path File to create or replace
+ * @param freqMap Table mapping words to uint64_t counts stored inline
+ * @param format RANKDUMP_TSV or RANKDUMP_BINARY
+ * @return true on success, false if memory ran out, the counts are not
+ *         stored inline or the file could not be written
+ */
+bool rankDump_writeTable(const char *path, hashTable *freqMap, rankDump_format format);
+
+#endif // RANK_DUMP_H
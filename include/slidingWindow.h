@@ -0,0 +1,131 @@
+/*
+ * Most Frequent Words - Sliding window counts
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef SLIDING_WINDOW_H
+#define SLIDING_WINDOW_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "topN.h"
+
+// Configuration for slidingWindow_create()
+typedef struct {
+    size_t bucket_count;        // buckets in the window, 0 for the default
+    uint64_t bucket_width;      // time units covered by each bucket, 0 for the default
+    size_t top_capacity;        // words ranked incrementally, 0 for the default
+} slidingWindow_config;
+
+// Opaque window, see slidingWindow_create()
+typedef struct slidingWindow slidingWindow;
+
+/**
+ * Create a window counting the words of the last bucket_count * bucket_width time units
+ *
+ * Time is whatever unit the caller passes to slidingWindow_add() (seconds,
+ * milliseconds, log timestamps), it only has to be non-decreasing for the
+ * window to slide. Every bucket counts the words of its time span in a
+ * table of its own, and one more table holds the sum over the window. When
+ * time moves past a bucket, its counts are subtracted from the sum and
+ * words left at zero are deleted, so memory follows the vocabulary of the
+ * window rather than of everything seen.
+ *
+ * The best top_capacity words are kept ranked as words are added, so a
+ * query of up to that many words costs O(top_capacity) however large the
+ * vocabulary. They are ranked again from the sum only when a bucket expires.
+ *
+ * @param config Configuration, NULL to use the defaults
+ * @return New window, NULL on allocation failure
+ */
+slidingWindow *slidingWindow_create(const slidingWindow_config *config);
+
+/**
+ * Destroy a window
+ * @param window Window to destroy, can be NULL (no-op)
+ */
+void slidingWindow_destroy(slidingWindow *window);
+
+/**
+ * Count one occurrence of a word at a point in time
+ *
+ * A time past the newest bucket slides the window first. A time older than
+ * the window is dropped (see slidingWindow_getDropped()), a time inside it
+ * is counted in its own bucket, so slightly late events are still placed
+ * correctly.
+ *
+ * @param window Window to update
+ * @param word The word bytes (need not be null-terminated)
+ * @param length Length of the word in bytes
+ * @param time Time of the occurrence
+ * @return true on success, false if memory ran out
+ */
+bool slidingWindow_add(slidingWindow *window, const char *word, size_t length, uint64_t time);
+
+/**
+ * Count every word of a piece of text, such as a log line, at a point in time
+ * @param window Window to update
+ * @param text Text to scan, words are cleaned like wordScanner does
+ * @param length Number of bytes in text
+ * @param time Time of the text
+ * @return true on success, false if memory ran out
+ */
+bool slidingWindow_addText(slidingWindow *window, const char *text, size_t length, uint64_t time);
+
+/**
+ * Slide the window up to a point in time without counting anything
+ *
+ * Lets a quiet stream expire old counts before a query.
+ *
+ * @param window Window to update
+ * @param time Current time, earlier times are ignored
+ * @return true on success, false if memory ran out while ranking again
+ */
+bool slidingWindow_advance(slidingWindow *window, uint64_t time);
+
+/**
+ * Select the n highest ranked words of the window
+ * @param window Window to query
+ * @param n Number of words to select, at most top_capacity for the fast path
+ * @param result Array of at least n slots, receives the words in ranking
+ *               order. They point into the window and are only valid until
+ *               it is next updated.
+ * @param selected Receives the number of words written
+ * @return true on success, false if memory ran out (larger n only)
+ */
+bool slidingWindow_top(slidingWindow *window, size_t n, WordCount *result, size_t *selected);
+
+/**
+ * Count of a word in the window
+ * @param window Window to query
+ * @param word The word bytes (need not be null-terminated)
+ * @param length Length of the word in bytes
+ * @return Occurrences of the word in the window, 0 if none
+ */
+uint64_t slidingWindow_count(slidingWindow *window, const char *word, size_t length);
+
+/**
+ * Number of distinct words in the window
+ * @param window Window to query
+ * @return Number of words with a non-zero count
+ */
+size_t slidingWindow_getLength(slidingWindow *window);
+
+/**
+ * Number of words counted in the window
+ * @param window Window to query
+ * @return Sum of every count
+ */
+uint64_t slidingWindow_getTotal(slidingWindow *window);
+
+/**
+ * Number of words dropped for being older than the window
+ * @param window Window to query
+ * @return Words dropped since the window was created
+ */
+uint64_t slidingWindow_getDropped(slidingWindow *window);
+
+#endif // SLIDING_WINDOW_H
@@ -0,0 +1,154 @@
+/*
+ * Most Frequent Words - Binary frequency snapshots
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashTable.h"
+#include "topN.h"
+
+// First bytes of every snapshot file
+#define SNAPSHOT_MAGIC "MFWSNAP1"
+// Format version written by this code
+#define SNAPSHOT_VERSION (1u)
+
+/*
+ * File layout, every field in native byte order (byte_order tells it apart):
+ *
+ *   snapshot_header                          64 bytes
+ *   uint64_t counts[word_count]              count of word i
+ *   uint64_t offsets[word_count + 1]         start of word i in keys, offsets[word_count] == key_bytes
+ *   char keys[key_bytes]                     every word followed by '\0', in strcmp order
+ *
+ * Words are sorted, so a word is found by binary search and snapshots are
+ * merged by walking them side by side. Every section is 8-byte aligned in a
+ * mapping of the file, so the arrays are used in place.
+ */
+typedef struct {
+    char magic[8];              // SNAPSHOT_MAGIC, not null-terminated
+    uint32_t version;           // SNAPSHOT_VERSION
+    uint32_t byte_order;        // 0x01020304 as written by the producing machine
+    uint64_t word_count;        // distinct words
+    uint64_t total_count;       // sum of all counts
+    uint64_t key_bytes;         // bytes of the keys section
+    uint64_t checksum;          // of every byte after the header, see snapshot_open()
+    uint64_t reserved[2];       // zero
+} snapshot_header;
+
+// An open snapshot, its arrays point into the mapped (or loaded) file
+typedef struct {
+    const snapshot_header *header;  // file header
+    const uint64_t *counts;         // counts section
+    const uint64_t *offsets;        // offsets section
+    const char *keys;               // keys section
+    const void *data;               // whole file
+    size_t length;                  // bytes of the file
+    bool mapped;                    // data is a mapping, otherwise a heap copy
+} snapshot;
+
+/**
+ * Write every word of a frequency table to a snapshot file
+ *
+ * The file is written next to path under a temporary name and renamed over
+ * path once complete, so readers never see a partial snapshot.
+ *
+ * @param path Snapshot file to create or replace
+ * @param freqMap Table mapping words to uint64_t counts stored inline
+ * @return true on success, false if memory ran out or the file could not be written
+ */
+bool snapshot_writeTable(const char *path, hashTable *freqMap);
+
+/**
+ * Merge snapshots into a new one, adding the counts of words they share
+ *
+ * The inputs are walked side by side in word order, no table is built, so
+ * the memory used does not depend on the vocabulary. path may name one of
+ * the inputs: the old file stays mapped until the caller closes it.
+ *
+ * @param path Snapshot file to create or replace
+ * @param inputs Open snapshots to merge
+ * @param count Number of inputs
+ * @return true on success, false if the file could not be written
+ */
+bool snapshot_merge(const char *path, const snapshot *inputs, size_t count);
+
+/**
+ * Tell whether a file starts like a snapshot
+ * @param path File to check, only regular files are read
+ * @return true if path is a regular file beginning with SNAPSHOT_MAGIC
+ */
+bool snapshot_isSnapshot(const char *path);
+
+/**
+ * Open a snapshot for queries, mapping it into memory
+ *
+ * The header and section sizes are always checked against the file size.
+ * With verify set the checksum and every offset are checked too, which
+ * reads the whole file; without it the sections are trusted, so a file
+ * from outside the program must be opened with verify.
+ *
+ * @param path Snapshot file
+ * @param snap Receives the open snapshot
+ * @param verify Check the checksum and the offsets
+ * @return true on success, false if the file cannot be read or is not a
+ *         valid snapshot for this machine
+ */
+bool snapshot_open(const char *path, snapshot *snap, bool verify);
+
+/**
+ * Close a snapshot opened by snapshot_open()
+ * @param snap Snapshot to close, its pointers are NULL afterwards
+ */
+void snapshot_close(snapshot *snap);
+
+/**
+ * Number of distinct words of a snapshot
+ * @param snap Open snapshot
+ * @return Number of words
+ */
+size_t snapshot_getLength(const snapshot *snap);
+
+/**
+ * Word at a position of the sorted word list
+ * @param snap Open snapshot
+ * @param index Position, below snapshot_getLength()
+ * @param length Receives the length of the word, can be NULL
+ * @return The null-terminated word, inside the snapshot
+ */
+const char *snapshot_word(const snapshot *snap, size_t index, size_t *length);
+
+/**
+ * Count of a word, found by binary search over the sorted words
+ * @param snap Open snapshot
+ * @param word The word bytes (need not be null-terminated)
+ * @param length Length of the word in bytes
+ * @return The count of the word, 0 if it is not in the snapshot
+ */
+uint64_t snapshot_lookup(const snapshot *snap, const char *word, size_t length);
+
+/**
+ * Select the n highest ranked words of a snapshot, straight from its arrays
+ * @param snap Open snapshot
+ * @param n Number of words to select
+ * @param result Array of at least n slots, receives the words in ranking
+ *               order; they point into the snapshot
+ * @param selected Receives the number of words written
+ */
+void snapshot_top(const snapshot *snap, size_t n, WordCount *result, size_t *selected);
+
+/**
+ * Add every count of a snapshot into a frequency table
+ * @param snap Open snapshot
+ * @param freqMap Table mapping words to uint64_t counts stored inline
+ * @return true on success, false if memory ran out
+ */
+bool snapshot_addToTable(const snapshot *snap, hashTable *freqMap);
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,94 @@
+/*
+ * Most Frequent Words - Space-Saving heavy hitters summary
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef SPACE_SAVING_H
+#define SPACE_SAVING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Configuration for spaceSaving_create()
+typedef struct {
+    size_t memory_budget;       // bytes for counters and sketch, 0 for the default
+    bool use_sketch;            // back admissions with a Count-Min sketch
+} spaceSaving_config;
+
+// A monitored word: its true count lies in [count - error, count]
+typedef struct {
+    const char *word;           // null-terminated, owned by the summary
+    uint64_t count;             // upper bound of the number of occurrences
+    uint64_t error;             // maximum overestimation of count
+} spaceSaving_estimate;
+
+// Opaque summary, see spaceSaving_create()
+typedef struct spaceSaving spaceSaving;
+
+/**
+ * Create a Space-Saving summary of a fixed number of counters
+ *
+ * The counters are kept in a stream-summary (buckets of equal count in count
+ * order), so counting a word is O(1). A word that is not monitored replaces
+ * the word with the smallest count. Every word occurring more than
+ * total / capacity times is guaranteed to be monitored.
+ *
+ * With use_sketch, a Count-Min sketch (conservative update) also sees every
+ * word, and a replacing word starts from the smaller of its sketch estimate
+ * and the classic min + 1 (the largest evicted count + 1), which tightens the
+ * count and error of words that arrive late in the stream.
+ *
+ * @param config Configuration, NULL to use the defaults
+ * @return New summary, NULL on allocation failure
+ *
+ * @note The budget sizes the counters, the index and the sketch up front,
+ *       assuming SPACESAVING_KEY_BYTES_ESTIMATE bytes per monitored key.
+ *       Nothing else grows with the input except longer keys.
+ */
+spaceSaving *spaceSaving_create(const spaceSaving_config *config);
+
+/**
+ * Destroy a summary
+ * @param summary Summary to destroy, can be NULL (no-op)
+ */
+void spaceSaving_destroy(spaceSaving *summary);
+
+/**
+ * Count one occurrence of a word
+ * @param summary Summary to update
+ * @param word Word bytes, need not be null-terminated
+ * @param length Number of bytes in word
+ * @return true on success, false if the key copy could not be allocated
+ */
+bool spaceSaving_add(spaceSaving *summary, const char *word, size_t length);
+
+/**
+ * Select the n monitored words with the highest counts
+ *
+ * @param summary Summary to query
+ * @param n Number of words to select
+ * @param result Array of at least n slots, receives the words ordered by
+ *               count descending, then word ascending. The words are only
+ *               valid until the next spaceSaving_add() or destroy.
+ * @param selected Receives the number of words written
+ * @return true on success, false on allocation failure
+ */
+bool spaceSaving_top(spaceSaving *summary, size_t n, spaceSaving_estimate *result, size_t *selected);
+
+/**
+ * Number of counters, i.e. the most words monitored at once
+ * @param summary Summary to query
+ * @return Number of counters
+ */
+size_t spaceSaving_getCapacity(const spaceSaving *summary);
+
+/**
+ * Number of occurrences counted so far
+ * @param summary Summary to query
+ * @return Total of all spaceSaving_add() calls
+ */
+uint64_t spaceSaving_getTotal(const spaceSaving *summary);
+
+#endif // SPACE_SAVING_H
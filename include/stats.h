@@ -0,0 +1,97 @@
+/*
+ * Most Frequent Words - Compile-time instrumentation
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "stats_cfg.h"
+#include "hashTable.h"
+
+// Timed phases of a run, in pipeline order
+typedef enum {
+    STATS_PHASE_SCAN = 0,       // reading the input and counting its words
+    STATS_PHASE_MERGE,          // merging per-thread tables
+    STATS_PHASE_SNAPSHOT,       // writing the counts to a snapshot
+    STATS_PHASE_DUMP,           // ranking every word and writing the dump file
+    STATS_PHASE_SELECT,         // selecting the top words
+    STATS_PHASE_COPY,           // copying the selected words out of the table
+    STATS_PHASES                // number of phases
+} stats_phase;
+
+// Everything recorded since the start of the process or the last stats_reset()
+typedef struct {
+    double phase_s[STATS_PHASES];       // seconds spent in each phase
+    uint64_t phase_calls[STATS_PHASES]; // times each phase ran
+    uint64_t allocations;               // heap allocations of the tables, arenas and ranked word copies
+    uint64_t allocated_bytes;           // bytes requested by those allocations
+    uint64_t tables;                    // hash tables destroyed
+    hashTable_stats table_totals;       // their counters, summed
+    hashTable_stats largest_table;      // shape of the largest one when destroyed
+} stats_report;
+
+/*
+ * Probes placed in the hot paths. With STATS_ENABLED 0 they expand to
+ * nothing (a timer start is the constant 0.0), so the default build pays
+ * nothing for them.
+ */
+#if STATS_ENABLED
+#define STATS_START() stats_now()
+#define STATS_STOP(phase, start) stats_addPhase((phase), (start))
+#define STATS_ALLOCATION(bytes) stats_countAllocation(bytes)
+#define STATS_ADD(counter, amount) ((counter) += (amount))
+#else
+#define STATS_START() (0.0)
+#define STATS_STOP(phase, start) ((void)(start))
+#define STATS_ALLOCATION(bytes) ((void)0)
+#define STATS_ADD(counter, amount) ((void)0)
+#endif
+
+/**
+ * Monotonic clock used by the phase timers
+ * @return Seconds since an arbitrary origin
+ */
+double stats_now(void);
+
+/**
+ * Add the time since start to a phase, safe from any thread
+ * @param phase Phase to charge
+ * @param start Value of stats_now() when the phase began
+ */
+void stats_addPhase(stats_phase phase, double start);
+
+/**
+ * Count one heap allocation, safe from any thread
+ * @param bytes Bytes requested
+ */
+void stats_countAllocation(uint64_t bytes);
+
+/**
+ * Fold the statistics of a table being destroyed into the report
+ * @param table Statistics from hashTable_getStats()
+ */
+void stats_addTable(const hashTable_stats *table);
+
+/**
+ * Read everything recorded so far
+ * @param report Receives the statistics, all zero when STATS_ENABLED is 0
+ */
+void stats_get(stats_report *report);
+
+/**
+ * Forget everything recorded so far
+ */
+void stats_reset(void);
+
+/**
+ * Print the report in readable form, one "stats:" line per item
+ * @param out Stream to print to, such as stderr
+ */
+void stats_dump(FILE *out);
+
+#endif // STATS_H
@@ -0,0 +1,144 @@
+/*
+ * Most Frequent Words - Stopword filter on a minimal perfect hash
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef STOPWORDS_H
+#define STOPWORDS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Longest stopword: a word is held whole in the two 64-bit words of its key
+#define STOPWORDS_MAX_LENGTH (16)
+
+// A stopword as it is compared, see stopwords_makeKey()
+typedef struct {
+    uint64_t head;              // first bytes of the word
+    uint64_t tail;              // last bytes of the word
+    uint64_t length;            // bytes of the word
+} stopwords_key;
+
+/*
+ * Minimal perfect hash of n words: every word has its own one of n slots.
+ * A word hashes to a bucket and to a 32-bit value, the bucket's
+ * displacement is chosen so that the value and displacement together send
+ * each word of the bucket to a free slot. A lookup costs one hash, one
+ * multiplication and the comparison of one key, whatever the list.
+ */
+typedef struct {
+    const stopwords_key *keys;          // key of the word in each slot
+    const uint32_t *displacements;      // displacement of each bucket
+    size_t count;                       // words, and slots
+    size_t bucket_count;                // buckets, at least 1
+    uint64_t seed;                      // seed of the word hash
+    uint32_t lengths;                   // bit l set when some stopword is l bytes long
+} stopwords;
+
+// Built-in stopwords (English), generated from cfg/stopwords.txt into src/stopwordTable.c
+extern const stopwords stopwords_builtin;
+
+/**
+ * Load a stopword list from a file
+ *
+ * The file is read like any text (gzip included), its words separated by
+ * whitespace. They are cleaned like the words of the text, so "Don't"
+ * filters "dont", and duplicates are dropped. The perfect hash is built
+ * once here, lookups then cost as much as with stopwords_builtin.
+ *
+ * @param path File to read
+ * @return New filter, NULL if the file cannot be read, memory ran out or a
+ *         word is longer than STOPWORDS_MAX_LENGTH bytes once cleaned.
+ *         Free it with stopwords_destroy().
+ */
+stopwords *stopwords_load(const char *path);
+
+/**
+ * Build a filter from words in memory
+ * @param words Words, cleaned like the words of the text
+ * @param count Number of words
+ * @return New filter, NULL on failure as for stopwords_load()
+ */
+stopwords *stopwords_create(const char *const *words, size_t count);
+
+/**
+ * Destroy a filter created by stopwords_load() or stopwords_create()
+ * @param filter Filter to destroy, can be NULL (no-op)
+ */
+void stopwords_destroy(stopwords *filter);
+
+// Little-endian 4-byte load, so keys match the generated table on any machine
+static inline uint64_t stopwords_read32(const char *p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap32(value);
+#endif
+    return value;
+}
+
+/**
+ * Key of a word of 1 to STOPWORDS_MAX_LENGTH bytes
+ *
+ * Overlapping 4-byte reads (single bytes below 4) cover every byte of the
+ * word, so two words of the same length have the same key only if they are
+ * equal, and no byte past the word is read.
+ */
+static inline stopwords_key stopwords_makeKey(const char *word, size_t length) {
+    stopwords_key key;
+    if (length >= 4) {
+        size_t shift = (length >> 3) << 2;
+        key.head = (stopwords_read32(word) << 32) | stopwords_read32(word + shift);
+        key.tail = (stopwords_read32(word + length - 4) << 32) | stopwords_read32(word + length - 4 - shift);
+    } else {
+        const unsigned char *bytes = (const unsigned char *)word;
+        key.head = ((uint64_t)bytes[0] << 16) | ((uint64_t)bytes[length >> 1] << 8) | bytes[length - 1];
+        key.tail = 0;
+    }
+    key.length = length;
+    return key;
+}
+
+// Hash of a key: the high half picks the bucket, the low half the slot
+static inline uint64_t stopwords_hash(const stopwords_key *key, uint64_t seed) {
+    uint64_t h = (key->head ^ seed) * UINT64_C(0x9E3779B97F4A7C15);
+    h ^= (key->tail + key->length) * UINT64_C(0xC2B2AE3D27D4EB4F);
+    h ^= h >> 29;
+    h *= UINT64_C(0xBF58476D1CE4E5B9);
+    return h ^ (h >> 32);
+}
+
+// Slot of a word hash under a displacement, out of count slots
+static inline size_t stopwords_slot(uint64_t hash, uint32_t displacement, size_t count) {
+    uint64_t mixed = ((uint64_t)((uint32_t)hash ^ displacement) * UINT64_C(0x9E3779B97F4A7C15)) >> 32;
+    return (size_t)((mixed * count) >> 32);
+}
+
+// Bucket of a word hash, out of bucketCount buckets
+static inline size_t stopwords_bucket(uint64_t hash, size_t bucketCount) {
+    return (size_t)(((hash >> 32) * bucketCount) >> 32);
+}
+
+/**
+ * Whether a word is a stopword
+ * @param filter Stopword filter
+ * @param word Cleaned word, not null-terminated
+ * @param length Bytes of the word
+ * @return true for a word of the list
+ */
+static inline bool stopwords_contains(const stopwords *filter, const char *word, size_t length) {
+    // Most words longer than any stopword never get hashed
+    if (length > STOPWORDS_MAX_LENGTH || (filter->lengths & ((uint32_t)1 << length)) == 0) {
+        return false;
+    }
+    stopwords_key key = stopwords_makeKey(word, length);
+    uint64_t hash = stopwords_hash(&key, filter->seed);
+    uint32_t displacement = filter->displacements[stopwords_bucket(hash, filter->bucket_count)];
+    const stopwords_key *slot = &filter->keys[stopwords_slot(hash, displacement, filter->count)];
+    return ((slot->head ^ key.head) | (slot->tail ^ key.tail) | (slot->length ^ key.length)) == 0;
+}
+
+#endif // STOPWORDS_H
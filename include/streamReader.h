@@ -0,0 +1,67 @@
+/*
+ * Most Frequent Words - Pipelined stream input
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef STREAM_READER_H
+#define STREAM_READER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wordScanner.h"
+
+// What a stream scan moved and how long each side waited for the other
+typedef struct {
+    uint64_t bytes;             // bytes read from the descriptor
+    uint64_t inflated;          // bytes decompressed from gzip input, 0 for plain input
+    uint64_t reads;             // read() calls that returned data
+    uint64_t buffers;           // ring buffers handed to the scanner
+    uint64_t reader_stalls;     // times the reader found the ring full (scanning is the bottleneck)
+    uint64_t scanner_stalls;    // times the scanner found the ring empty (input is the bottleneck)
+    double reader_wait_s;       // seconds the reader spent waiting for a free buffer
+    double scanner_wait_s;      // seconds the scanner spent waiting for data
+    double elapsed_s;           // wall time of the whole scan
+} streamReader_stats;
+
+/**
+ * Scan every word read from a file descriptor until end of input
+ *
+ * A reader thread fills a ring of STREAMREADER_RING_SIZE buffers of
+ * STREAMREADER_BUFFER_SIZE bytes with read() while the calling thread scans
+ * them, so waiting on the producer of a pipe overlaps with counting. A buffer
+ * is handed over when it is full, at end of input, or early when the
+ * scanner has nothing left to do. If the thread cannot be started the
+ * descriptor is read and scanned on the calling thread.
+ *
+ * Input starting with the gzip magic bytes is decompressed by the reader
+ * thread, member after member, straight into the ring buffers, so inflating
+ * overlaps with counting and memory stays at the ring plus one buffer of
+ * compressed input, whatever the uncompressed size.
+ *
+ * @param fd Descriptor to read, such as 0 for stdin; not closed
+ * @param scanner Initialized scanner; finished (the last word flushed) on success
+ * @param stats Receives the transfer and stall counts, can be NULL
+ * @return true on success, false if reading failed, memory ran out, the
+ *         scanner failed, or the input is compressed and corrupt, truncated
+ *         or cannot be decompressed by this build
+ */
+bool streamReader_scanFd(int fd, wordScanner *scanner, streamReader_stats *stats);
+
+/**
+ * Check whether data starts like gzip input
+ * @param data First bytes of the input
+ * @param length Number of bytes in data
+ * @return true if data starts with the gzip magic bytes
+ */
+bool streamReader_isCompressed(const char *data, size_t length);
+
+/**
+ * Check whether this build can decompress gzip input
+ * @return true if built with zlib (ZLIB_ENABLED)
+ */
+bool streamReader_canDecompress(void);
+
+#endif // STREAM_READER_H
@@ -0,0 +1,85 @@
+/*
+ * Most Frequent Words - Top-N selection
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef TOP_N_H
+#define TOP_N_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashTable.h"
+
+// A word and its count, the word points at a key owned by the hash table
+typedef struct
+{
+    const char *word;
+    uint64_t count;
+} WordCount;
+
+// Incremental selection of the best words among those offered one at a time
+typedef struct
+{
+    WordCount *heap;    // result slots, a heap with the worst kept word at the root
+    size_t capacity;    // number of words to keep
+    size_t size;        // words kept so far
+} topN_heap;
+
+/**
+ * Ranking order: count descending, then word ascending (strcmp)
+ * @param a Pointer to the first WordCount
+ * @param b Pointer to the second WordCount
+ * @return Negative if a ranks before b, positive if after, 0 if equal
+ */
+int cmpWordCount(const void *a, const void *b);
+
+/**
+ * Select the n highest ranked words of a frequency table
+ *
+ * Walks the table iterator once. For small n a size-n binary heap keeps the
+ * best words seen so far, so only the n result slots are used. When n is a
+ * large fraction of the vocabulary (see TOPN_HEAP_MAX_FRACTION) the words are
+ * partitioned with quickselect instead.
+ *
+ * @param freqMap Table mapping words to uint64_t counts stored inline
+ *                (value_size == sizeof(uint64_t))
+ * @param n Number of words to select
+ * @param result Array of at least n slots, receives the selected words in
+ *               ranking order. The words point into freqMap and are only
+ *               valid until it is modified or destroyed.
+ * @param selected Receives the number of words written, min(n, vocabulary size)
+ * @return true on success, false if the quickselect buffer could not be allocated
+ */
+bool topN_select(hashTable *freqMap, size_t n, WordCount *result, size_t *selected);
+
+/**
+ * Start an incremental selection of the n highest ranked words
+ * @param heap Selection state to initialize
+ * @param result Array of at least n slots, receives the kept words
+ * @param n Number of words to keep
+ */
+void topN_heapInit(topN_heap *heap, WordCount *result, size_t n);
+
+/**
+ * Offer a word to an incremental selection
+ *
+ * The word is kept if fewer than n words were offered so far or if it ranks
+ * before the worst kept word, which it then replaces (O(log n)).
+ *
+ * @param heap Selection state
+ * @param word The word, must stay valid until the selection is finished
+ * @param count Its count
+ */
+void topN_heapOffer(topN_heap *heap, const char *word, uint64_t count);
+
+/**
+ * Sort the kept words into ranking order
+ * @param heap Selection state, its result array holds the ranking afterwards
+ * @return Number of words in the ranking, min(n, words offered)
+ */
+size_t topN_heapFinish(topN_heap *heap);
+
+#endif // TOP_N_H
@@ -0,0 +1,48 @@
+/*
+ * Most Frequent Words - Unicode class and case folding tables
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#include <stdint.h>
+
+// Code points per block of the second stage, see tools/unicodeTablesGen.py
+#define UNICODETABLES_BLOCK_SHIFT (7)
+
+// Largest code point
+#define UNICODETABLES_MAX_CODE_POINT (0x10FFFF)
+
+// What cleaning does with a code point
+typedef enum {
+    UNICODETABLES_KEPT = 0,     // letters, digits, marks...: kept, case folded
+    UNICODETABLES_REMOVED,      // punctuation, symbols and format characters: removed from words
+    UNICODETABLES_WHITESPACE    // separators: end a word
+} unicodeTables_class;
+
+// Class and simple case folding of a code point
+typedef struct {
+    int32_t foldDelta;          // added to the code point to case fold it
+    uint8_t charClass;          // unicodeTables_class
+} unicodeTables_property;
+
+// Generated into src/unicodeTables.c
+extern const unicodeTables_property unicodeTables_properties[];
+extern const uint8_t unicodeTables_blockIndex[];
+extern const uint8_t unicodeTables_blocks[][1 << UNICODETABLES_BLOCK_SHIFT];
+
+/**
+ * Class and case folding of a code point
+ * @param codePoint Code point, at most UNICODETABLES_MAX_CODE_POINT
+ * @return Its property, the folded code point is codePoint + foldDelta and
+ *         never takes more UTF-8 bytes than codePoint
+ */
+static inline const unicodeTables_property *unicodeTables_lookup(uint32_t codePoint) {
+    uint8_t block = unicodeTables_blockIndex[codePoint >> UNICODETABLES_BLOCK_SHIFT];
+    uint8_t entry = unicodeTables_blocks[block][codePoint & ((1u << UNICODETABLES_BLOCK_SHIFT) - 1)];
+    return &unicodeTables_properties[entry];
+}
+
+#endif // UNICODE_TABLES_H
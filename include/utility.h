@@ -7,10 +7,41 @@
 #ifndef UTILITY_H
 #define UTILITY_H
 
+#include <stddef.h>
+
 /**
  * Clean and convert word to lowercase, removing punctuation
+ *
+ * ASCII follows the C locale, as ispunct() and tolower() do. UTF-8 beyond
+ * ASCII is cleaned a code point at a time: punctuation, symbols, format
+ * characters and whitespace are removed, and letters are case folded
+ * (simple folding, never to a longer encoding). Bytes that are not valid
+ * UTF-8 are kept unchanged.
+ *
  * @param word The word to clean (modified in place)
  */
 void clean_and_lowercase(char *word);
 
-#endif // UTILITY_H
\ No newline at end of file
+/**
+ * Clean and convert a word given as a (pointer, length) slice to lowercase,
+ * removing punctuation, without null-terminating the result
+ * @param dst Destination buffer of at least length bytes (may equal src)
+ * @param src The word bytes to clean
+ * @param length Number of bytes in the word
+ * @return Number of bytes written to dst
+ */
+size_t clean_and_lowercase_slice(char *dst, const char *src, size_t length);
+
+/**
+ * Clean the first word of a slice like clean_and_lowercase_slice(), stopping
+ * after the first whitespace character beyond ASCII (e.g. U+00A0, U+3000)
+ * @param dst Destination buffer of at least length bytes (may equal src)
+ * @param src The bytes to clean, holding no ASCII whitespace
+ * @param length Number of bytes in src
+ * @param consumed Receives the bytes of src used, including the whitespace
+ *                 character that ended the word
+ * @return Number of bytes written to dst, 0 if the word cleaned down to nothing
+ */
+size_t clean_and_lowercase_next(char *dst, const char *src, size_t length, size_t *consumed);
+
+#endif // UTILITY_H
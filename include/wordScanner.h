@@ -0,0 +1,132 @@
+/*
+ * Most Frequent Words - In-place word scanner
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#ifndef WORD_SCANNER_H
+#define WORD_SCANNER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashFunctions.h"
+#include "stopwords.h"
+
+/**
+ * Called once for every cleaned, non-empty word
+ * @param word Pointer to the word bytes (not null-terminated), valid only
+ *             for the duration of the call
+ * @param length Number of bytes in the word
+ * @param context User pointer given to wordScanner_init()
+ * @return true to continue scanning, false to abort
+ */
+typedef bool (*wordScanner_callback)(const char *word, size_t length, void *context);
+
+/**
+ * Called once for every cleaned, non-empty word, together with its hash
+ * @param word Pointer to the word bytes (not null-terminated), valid only
+ *             for the duration of the call
+ * @param length Number of bytes in the word
+ * @param hash Hash of the word, from the function given to wordScanner_initHashed()
+ * @param context User pointer given to wordScanner_initHashed()
+ * @return true to continue scanning, false to abort
+ */
+typedef bool (*wordScanner_hashedCallback)(const char *word, size_t length, uint64_t hash, void *context);
+
+// Scanner state, carries an unfinished word from one buffer to the next
+typedef struct {
+    wordScanner_callback callback;  // receives every word
+    wordScanner_hashedCallback hashedCallback; // receives every word and its hash, instead of callback
+    hashFunctions_fn hash;          // hashes words for hashedCallback
+    uint64_t hashSeed;              // seed passed to hash
+    void *context;                  // user pointer passed to callback
+    const stopwords *filter;        // words never passed to the callback, NULL for none
+    char *buffer;                   // scratch space for cleaned and carried words
+    size_t bufferCapacity;          // allocated size of buffer
+    size_t carryLength;             // bytes of an unfinished word held in buffer
+    bool carryDirty;                // carried word contains bytes to clean
+} wordScanner;
+
+/**
+ * Initialize a scanner
+ * @param scanner Scanner to initialize
+ * @param callback Function receiving every word
+ * @param context User pointer passed to callback
+ */
+void wordScanner_init(wordScanner *scanner, wordScanner_callback callback, void *context);
+
+/**
+ * Initialize a scanner that hashes every word it produces
+ *
+ * Each word is hashed as soon as it is found, or cleaned, while its bytes
+ * are still in the L1 cache, so a hash table can be probed without hashing
+ * the word again (see hashTable_incrementOrInsertHashed()).
+ *
+ * @param scanner Scanner to initialize
+ * @param callback Function receiving every word and its hash
+ * @param hash Hash function, a table's hash_function to probe that table
+ * @param seed Seed passed to hash, the table's hash_seed
+ * @param context User pointer passed to callback
+ */
+void wordScanner_initHashed(wordScanner *scanner, wordScanner_hashedCallback callback,
+                            hashFunctions_fn hash, uint64_t seed, void *context);
+
+/**
+ * Drop stopwords before they reach the callback
+ *
+ * A filtered word is not hashed nor passed on, so it costs one perfect hash
+ * lookup instead of a table update.
+ *
+ * @param scanner Initialized scanner
+ * @param filter Stopwords to drop, NULL to pass every word; must outlive the scanner
+ */
+void wordScanner_setFilter(wordScanner *scanner, const stopwords *filter);
+
+/**
+ * Scan a buffer for words
+ *
+ * Words are runs of non-whitespace bytes (NUL also separates words), further
+ * split by UTF-8 whitespace such as U+00A0 or U+3000. Each word is cleaned
+ * like clean_and_lowercase() and passed to the callback as a slice: words
+ * that are already clean point straight into data, others are cleaned into
+ * the scanner's scratch buffer. Runs without a byte >= 0x80 never leave the
+ * ASCII path. A word touching the end of data is kept
+ * until the next feed or wordScanner_finish(), so buffers may split words
+ * anywhere. Words that clean down to nothing are skipped.
+ *
+ * @param scanner Initialized scanner
+ * @param data Bytes to scan
+ * @param length Number of bytes in data
+ * @return true on success, false if the callback aborted or memory ran out
+ */
+bool wordScanner_feed(wordScanner *scanner, const char *data, size_t length);
+
+/**
+ * Flush the word carried over from the last feed, if any
+ * @param scanner Initialized scanner
+ * @return true on success, false if the callback aborted or memory ran out
+ */
+bool wordScanner_finish(wordScanner *scanner);
+
+/**
+ * Release the scanner's scratch buffer
+ * @param scanner Scanner to clean up, can be reinitialized afterwards
+ */
+void wordScanner_destroy(wordScanner *scanner);
+
+/**
+ * Find the first word boundary at or after an offset
+ *
+ * Splitting a buffer at the returned offset never cuts a word in two, which
+ * lets independent scanners process the pieces in parallel.
+ *
+ * @param data Bytes to search
+ * @param length Number of bytes in data
+ * @param offset Offset to start searching from
+ * @return Offset of the first separator byte at or after offset, or length
+ */
+size_t wordScanner_nextBoundary(const char *data, size_t length, size_t offset);
+
+#endif // WORD_SCANNER_H
@@ -0,0 +1,114 @@
+/*
+ * Most Frequent Words - Arena (bump) allocator
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena_cfg.h"
+#include "arena.h"
+#include "stats.h"
+
+// Allocates a block with room for at least size bytes and makes it the head
+static arena_block *pushBlock(arena *a, size_t size) {
+    size_t blockSize = (size > a->block_size) ? size : a->block_size;
+    if (blockSize > SIZE_MAX - sizeof(arena_block)) {
+        return NULL;
+    }
+
+    arena_block *block = malloc(sizeof(arena_block) + blockSize);
+    if (block == NULL) {
+        return NULL;
+    }
+    STATS_ALLOCATION(sizeof(arena_block) + blockSize);
+    block->size = blockSize;
+    block->used = 0;
+
+    if (a->head != NULL && size > a->block_size) {
+        // Oversized request: keep filling the current block afterwards
+        block->next = a->head->next;
+        a->head->next = block;
+    } else {
+        block->next = a->head;
+        a->head = block;
+    }
+    a->bytes_reserved += blockSize;
+    return block;
+}
+
+arena *arena_create(size_t blockSize) {
+    arena *a = malloc(sizeof(arena));
+    if (a == NULL) {
+        return NULL;
+    }
+    STATS_ALLOCATION(sizeof(arena));
+    a->head = NULL;
+    a->block_size = (blockSize == 0) ? (size_t)ARENA_DEFAULT_BLOCK_SIZE : blockSize;
+    a->bytes_used = 0;
+    a->bytes_reserved = 0;
+    return a;
+}
+
+void arena_destroy(arena *a) {
+    if (a == NULL) {
+        return;
+    }
+    arena_block *block = a->head;
+    while (block != NULL) {
+        arena_block *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(a);
+}
+
+// Returns an aligned pointer to size free bytes of block, or NULL if they do not fit
+static void *bumpBlock(arena *a, arena_block *block, size_t size, size_t alignment) {
+    uintptr_t address = (uintptr_t)(block->data + block->used);
+    size_t padding = (size_t)(-address & (alignment - 1));
+    size_t available = block->size - block->used;
+
+    if (padding > available || size > available - padding) {
+        return NULL;
+    }
+    block->used += padding + size;
+    a->bytes_used += size;
+    return block->data + block->used - size;
+}
+
+void *arena_alloc(arena *a, size_t size, size_t alignment) {
+    if (a->head != NULL) {
+        void *memory = bumpBlock(a, a->head, size, alignment);
+        if (memory != NULL) {
+            return memory;
+        }
+    }
+
+    // Current block is full, reserve room for the worst-case padding too
+    if (size > SIZE_MAX - alignment) {
+        return NULL;
+    }
+    arena_block *block = pushBlock(a, size + alignment - 1);
+    if (block == NULL) {
+        return NULL;
+    }
+    return bumpBlock(a, block, size, alignment);
+}
+
+char *arena_strndup(arena *a, const char *str, size_t length) {
+    char *copy = arena_alloc(a, length + 1, 1);
+    if (copy == NULL) {
+        return NULL;
+    }
+    memcpy(copy, str, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+size_t arena_getBytesReserved(const arena *a) {
+    return (a != NULL) ? a->bytes_reserved : 0;
+}
@@ -0,0 +1,217 @@
+/*
+ * Most Frequent Words - Byte classification kernels
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "charClass.h"
+
+// SIMD kernels need GCC/Clang target attributes and an x86 CPU
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CHARCLASS_X86 1
+#include <immintrin.h>
+#endif
+
+// A set of kernel functions, all producing identical results
+typedef struct {
+    const char *name;
+    void (*classify)(const char *block, charClass_masks *masks);
+    void (*lowercase)(const char *src, char *dst);
+} charClassKernel;
+
+/*========================================================== */
+/*====================== Scalar kernel ===================== */
+/*========================================================== */
+static void classifyScalar(const char *block, charClass_masks *masks) {
+    uint64_t whitespace = 0;
+    uint64_t punctuation = 0;
+    uint64_t uppercase = 0;
+    uint64_t nonAscii = 0;
+
+    for (unsigned int i = 0; i < CHARCLASS_BLOCK_SIZE; i++) {
+        unsigned char c = (unsigned char)block[i];
+
+        // Branch-free, the classes are disjoint
+        whitespace |= (uint64_t)charClass_isWhitespace(c) << i;
+        punctuation |= (uint64_t)charClass_isPunctuation(c) << i;
+        uppercase |= (uint64_t)charClass_isUppercase(c) << i;
+        nonAscii |= (uint64_t)(c >> 7) << i;
+    }
+
+    masks->whitespace = whitespace;
+    masks->punctuation = punctuation;
+    masks->uppercase = uppercase;
+    masks->nonAscii = nonAscii;
+}
+
+static void lowercaseScalar(const char *src, char *dst) {
+    for (unsigned int i = 0; i < CHARCLASS_BLOCK_SIZE; i++) {
+        dst[i] = (char)charClass_toLower((unsigned char)src[i]);
+    }
+}
+
+static const charClassKernel scalarKernel = { "scalar", classifyScalar, lowercaseScalar };
+
+#ifdef CHARCLASS_X86
+
+/*========================================================== */
+/*======================= SSE2 kernel ====================== */
+/*========================================================== */
+
+// 0xFF in every byte of v within [lo, hi], as an unsigned range check
+__attribute__((target("sse2")))
+static inline __m128i inRangeSse2(__m128i v, unsigned char lo, unsigned char hi) {
+    __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8((char)lo));
+    __m128i clamped = _mm_min_epu8(offset, _mm_set1_epi8((char)(hi - lo)));
+    return _mm_cmpeq_epi8(clamped, offset);
+}
+
+__attribute__((target("sse2")))
+static void classifySse2(const char *block, charClass_masks *masks) {
+    uint64_t whitespace = 0;
+    uint64_t punctuation = 0;
+    uint64_t uppercase = 0;
+    uint64_t nonAscii = 0;
+
+    for (unsigned int i = 0; i < CHARCLASS_BLOCK_SIZE; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(block + i));
+
+        __m128i space = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                     _mm_or_si128(inRangeSse2(v, '\t', '\r'),
+                                                  _mm_cmpeq_epi8(v, _mm_setzero_si128())));
+        __m128i punct = _mm_or_si128(_mm_or_si128(inRangeSse2(v, '!', '/'), inRangeSse2(v, ':', '@')),
+                                     _mm_or_si128(inRangeSse2(v, '[', '`'), inRangeSse2(v, '{', '~')));
+        __m128i upper = inRangeSse2(v, 'A', 'Z');
+
+        whitespace |= (uint64_t)(uint16_t)_mm_movemask_epi8(space) << i;
+        punctuation |= (uint64_t)(uint16_t)_mm_movemask_epi8(punct) << i;
+        uppercase |= (uint64_t)(uint16_t)_mm_movemask_epi8(upper) << i;
+        nonAscii |= (uint64_t)(uint16_t)_mm_movemask_epi8(v) << i; // The high bit of each byte
+    }
+
+    masks->whitespace = whitespace;
+    masks->punctuation = punctuation;
+    masks->uppercase = uppercase;
+    masks->nonAscii = nonAscii;
+}
+
+__attribute__((target("sse2")))
+static void lowercaseSse2(const char *src, char *dst) {
+    for (unsigned int i = 0; i < CHARCLASS_BLOCK_SIZE; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i caseBit = _mm_and_si128(inRangeSse2(v, 'A', 'Z'), _mm_set1_epi8(0x20));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_add_epi8(v, caseBit));
+    }
+}
+
+static const charClassKernel sse2Kernel = { "sse2", classifySse2, lowercaseSse2 };
+
+/*========================================================== */
+/*======================= AVX2 kernel ====================== */
+/*========================================================== */
+
+// 0xFF in every byte of v within [lo, hi], as an unsigned range check
+__attribute__((target("avx2")))
+static inline __m256i inRangeAvx2(__m256i v, unsigned char lo, unsigned char hi) {
+    __m256i offset = _mm256_sub_epi8(v, _mm256_set1_epi8((char)lo));
+    __m256i clamped = _mm256_min_epu8(offset, _mm256_set1_epi8((char)(hi - lo)));
+    return _mm256_cmpeq_epi8(clamped, offset);
+}
+
+__attribute__((target("avx2")))
+static void classifyAvx2(const char *block, charClass_masks *masks) {
+    uint64_t whitespace = 0;
+    uint64_t punctuation = 0;
+    uint64_t uppercase = 0;
+    uint64_t nonAscii = 0;
+
+    for (unsigned int i = 0; i < CHARCLASS_BLOCK_SIZE; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(block + i));
+
+        __m256i space = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                                        _mm256_or_si256(inRangeAvx2(v, '\t', '\r'),
+                                                        _mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+        __m256i punct = _mm256_or_si256(_mm256_or_si256(inRangeAvx2(v, '!', '/'), inRangeAvx2(v, ':', '@')),
+                                        _mm256_or_si256(inRangeAvx2(v, '[', '`'), inRangeAvx2(v, '{', '~')));
+        __m256i upper = inRangeAvx2(v, 'A', 'Z');
+
+        whitespace |= (uint64_t)(uint32_t)_mm256_movemask_epi8(space) << i;
+        punctuation |= (uint64_t)(uint32_t)_mm256_movemask_epi8(punct) << i;
+        uppercase |= (uint64_t)(uint32_t)_mm256_movemask_epi8(upper) << i;
+        nonAscii |= (uint64_t)(uint32_t)_mm256_movemask_epi8(v) << i; // The high bit of each byte
+    }
+
+    masks->whitespace = whitespace;
+    masks->punctuation = punctuation;
+    masks->uppercase = uppercase;
+    masks->nonAscii = nonAscii;
+}
+
+__attribute__((target("avx2")))
+static void lowercaseAvx2(const char *src, char *dst) {
+    for (unsigned int i = 0; i < CHARCLASS_BLOCK_SIZE; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i caseBit = _mm256_and_si256(inRangeAvx2(v, 'A', 'Z'), _mm256_set1_epi8(0x20));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_add_epi8(v, caseBit));
+    }
+}
+
+static const charClassKernel avx2Kernel = { "avx2", classifyAvx2, lowercaseAvx2 };
+
+#endif // CHARCLASS_X86
+
+/*========================================================== */
+/*======================== Dispatch ======================== */
+/*========================================================== */
+
+// Kernel in use, upgraded at startup when the CPU supports a SIMD kernel
+static const charClassKernel *activeKernel = &scalarKernel;
+
+#ifdef CHARCLASS_X86
+// Runs before main(), so the kernel never changes while threads are scanning
+__attribute__((constructor))
+static void selectBestKernel(void) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        activeKernel = &avx2Kernel;
+    } else if (__builtin_cpu_supports("sse2")) {
+        activeKernel = &sse2Kernel;
+    }
+}
+#endif
+
+void charClass_classifyBlock(const char *block, charClass_masks *masks) {
+    activeKernel->classify(block, masks);
+}
+
+void charClass_lowercaseBlock(const char *src, char *dst) {
+    activeKernel->lowercase(src, dst);
+}
+
+bool charClass_selectKernel(const char *name) {
+    if (strcmp(name, scalarKernel.name) == 0) {
+        activeKernel = &scalarKernel;
+        return true;
+    }
+#ifdef CHARCLASS_X86
+    __builtin_cpu_init();
+    if (strcmp(name, sse2Kernel.name) == 0 && __builtin_cpu_supports("sse2")) {
+        activeKernel = &sse2Kernel;
+        return true;
+    }
+    if (strcmp(name, avx2Kernel.name) == 0 && __builtin_cpu_supports("avx2")) {
+        activeKernel = &avx2Kernel;
+        return true;
+    }
+#endif
+    return false; // Unknown kernel or not supported here
+}
+
+const char *charClass_kernelName(void) {
+    return activeKernel->name;
+}
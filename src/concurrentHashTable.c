@@ -0,0 +1,347 @@
+/*
+ * Most Frequent Words - Concurrent word counting table
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <sched.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "concurrentHashTable_cfg.h"
+#include "concurrentHashTable.h"
+#include "hashTable_cfg.h"
+#include "stats.h"
+
+// Smallest number of slots a table is created with
+#define CONCURRENTHASHTABLE_MIN_CAPACITY_BITS (3u)
+// Largest load factor accepted from a configuration, probing degrades past it
+#define CONCURRENTHASHTABLE_MAX_ALLOWED_LOAD_FACTOR (0.9)
+
+// A word and its counter, never moved or freed before the table is destroyed
+typedef struct {
+    uint64_t count;             // occurrences, updated with atomic adds
+    uint64_t hash;              // full hash of the key
+    size_t length;              // length of the key in bytes
+    char key[];                 // the key, null-terminated
+} wordRecord;
+
+// One generation of slots, replaced by a twice larger one when too full
+typedef struct slotArray {
+    wordRecord **slots;         // record pointers, NULL while empty, MOVED_SLOT once resized
+    size_t capacity;            // number of slots, a power of two
+    unsigned int capacityBits;  // log2(capacity)
+    size_t growThreshold;       // table length at which the resize starts
+    struct slotArray *next;     // array the records move to, NULL until a resize starts
+    struct slotArray *previous; // array this one replaced, freed with the table
+    int resizing;               // 1 while a thread allocates next, or once it did
+    size_t chunkCount;          // chunks of CONCURRENTHASHTABLE_MIGRATION_CHUNK slots
+    size_t nextChunk;           // next chunk to claim when moving records
+    size_t chunksDone;          // chunks whose records were moved
+} slotArray;
+
+struct concurrentHashTable {
+    slotArray *current;         // array inserts go to
+    size_t length;              // distinct words
+    uint64_t resizes;           // arrays replaced
+    double maxLoadFactor;       // load factor that starts a resize
+    hashFunctions_fn hashFunction; // hashes keys, see hashFunctions.h
+};
+
+// Marks an empty slot of an array being replaced: inserts must go to the next one
+static wordRecord movedSlot;
+#define MOVED_SLOT (&movedSlot)
+
+static slotArray *createArray(unsigned int capacityBits, double maxLoadFactor);
+static size_t homeSlot(const slotArray *array, uint64_t hash);
+static bool startResize(concurrentHashTable *table, slotArray *array);
+static bool helpResize(concurrentHashTable *table, slotArray *array);
+static void moveChunk(slotArray *array, size_t chunk);
+static void placeRecord(slotArray *array, wordRecord *record);
+static wordRecord *findRecord(slotArray *array, const char *key, size_t length, uint64_t hash);
+
+concurrentHashTable *concurrentHashTable_create(const concurrentHashTable_config *config) {
+    size_t capacity = (config != NULL) ? config->initial_capacity : 0;
+    double maxLoadFactor = (config != NULL) ? config->max_load_factor : 0.0;
+    hashFunctions_algorithm hashFunction = (config != NULL) ? config->hash_function : HASH_FUNCTION_DEFAULT;
+
+    if (capacity == 0) {
+        capacity = (size_t)CONCURRENTHASHTABLE_DEFAULT_CAPACITY;
+    }
+    if (!(maxLoadFactor > 0.0 && maxLoadFactor <= CONCURRENTHASHTABLE_MAX_ALLOWED_LOAD_FACTOR)) {
+        maxLoadFactor = (double)CONCURRENTHASHTABLE_DEFAULT_MAX_LOAD_FACTOR;
+    }
+    if (hashFunction == HASH_FUNCTION_DEFAULT) {
+        hashFunction = HASHTABLE_DEFAULT_HASH_FUNCTION;
+    }
+    unsigned int capacityBits = CONCURRENTHASHTABLE_MIN_CAPACITY_BITS;
+    while (((size_t)1 << capacityBits) < capacity) {
+        capacityBits++;
+    }
+
+    concurrentHashTable *table = (concurrentHashTable *)calloc(1, sizeof(concurrentHashTable));
+    STATS_ALLOCATION(sizeof(concurrentHashTable));
+    if (table == NULL) {
+        return NULL;
+    }
+    table->maxLoadFactor = maxLoadFactor;
+    table->hashFunction = hashFunctions_get(hashFunction);
+    table->current = createArray(capacityBits, maxLoadFactor);
+    if (table->current == NULL) {
+        free(table);
+        return NULL;
+    }
+    return table;
+}
+
+void concurrentHashTable_destroy(concurrentHashTable *table) {
+    if (table == NULL) {
+        return;
+    }
+    // Every resize finishes before the operation that started it returns,
+    // so the current array holds every record
+    slotArray *array = table->current;
+    for (size_t i = 0; i < array->capacity; i++) {
+        if (array->slots[i] != NULL && array->slots[i] != MOVED_SLOT) {
+            free(array->slots[i]);
+        }
+    }
+    while (array != NULL) {
+        slotArray *previous = array->previous;
+        free(array->slots);
+        free(array);
+        array = previous;
+    }
+    free(table);
+}
+
+bool concurrentHashTable_incrementOrInsert(concurrentHashTable *table, const char *key) {
+    return concurrentHashTable_addOrInsertLen(table, key, strlen(key), 1);
+}
+
+bool concurrentHashTable_incrementOrInsertLen(concurrentHashTable *table, const char *key, size_t length) {
+    return concurrentHashTable_addOrInsertLen(table, key, length, 1);
+}
+
+bool concurrentHashTable_addOrInsertLen(concurrentHashTable *table, const char *key, size_t length,
+                                        uint64_t amount) {
+    uint64_t hash = table->hashFunction(key, length, 0);
+    wordRecord *fresh = NULL; // record of the word, built the first time an empty slot is found
+
+    while (true) {
+        slotArray *array = __atomic_load_n(&table->current, __ATOMIC_ACQUIRE);
+        size_t mask = array->capacity - 1;
+        size_t index = homeSlot(array, hash);
+        bool retry = false;
+
+        for (size_t probes = 0; probes < array->capacity && !retry; probes++) {
+            wordRecord *record = __atomic_load_n(&array->slots[index], __ATOMIC_ACQUIRE);
+
+            if (record == NULL) {
+                if (fresh == NULL) {
+                    fresh = (wordRecord *)malloc(sizeof(wordRecord) + length + 1);
+                    STATS_ALLOCATION(sizeof(wordRecord) + length + 1);
+                    if (fresh == NULL) {
+                        return false;
+                    }
+                    fresh->count = amount;
+                    fresh->hash = hash;
+                    fresh->length = length;
+                    memcpy(fresh->key, key, length);
+                    fresh->key[length] = '\0';
+                }
+                // Publish the record, a failure means another thread took the slot first
+                if (__atomic_compare_exchange_n(&array->slots[index], &record, fresh, false,
+                                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                    size_t words = __atomic_add_fetch(&table->length, 1, __ATOMIC_RELAXED);
+                    if (words > array->growThreshold) {
+                        startResize(table, array); // Best effort, the array still has room
+                    }
+                    return true;
+                }
+            }
+
+            if (record == MOVED_SLOT) {
+                retry = true; // The word would be here, but inserts now go to the next array
+            } else if (record->hash == hash && record->length == length &&
+                       memcmp(record->key, key, length) == 0) {
+                __atomic_fetch_add(&record->count, amount, __ATOMIC_RELAXED);
+                free(fresh); // Inserted meanwhile by another thread
+                return true;
+            } else {
+                index = (index + 1) & mask;
+            }
+        }
+
+        // Moved slot, or no empty slot left: finish the resize and try its array
+        if (!retry && !startResize(table, array)) {
+            free(fresh);
+            return false;
+        }
+        if (!helpResize(table, array)) {
+            free(fresh);
+            return false;
+        }
+    }
+}
+
+uint64_t concurrentHashTable_count(concurrentHashTable *table, const char *key, size_t length) {
+    uint64_t hash = table->hashFunction(key, length, 0);
+    slotArray *array = __atomic_load_n(&table->current, __ATOMIC_ACQUIRE);
+
+    // A moved slot sends the search on to the next array, records are shared between them
+    while (array != NULL) {
+        wordRecord *record = findRecord(array, key, length, hash);
+        if (record != MOVED_SLOT) {
+            return (record != NULL) ? __atomic_load_n(&record->count, __ATOMIC_RELAXED) : 0;
+        }
+        array = __atomic_load_n(&array->next, __ATOMIC_ACQUIRE);
+    }
+    return 0;
+}
+
+size_t concurrentHashTable_getLength(concurrentHashTable *table) {
+    return __atomic_load_n(&table->length, __ATOMIC_RELAXED);
+}
+
+size_t concurrentHashTable_getCapacity(concurrentHashTable *table) {
+    return __atomic_load_n(&table->current, __ATOMIC_ACQUIRE)->capacity;
+}
+
+uint64_t concurrentHashTable_getResizes(concurrentHashTable *table) {
+    return __atomic_load_n(&table->resizes, __ATOMIC_RELAXED);
+}
+
+void concurrentHashTable_initIterator(concurrentHashTable *table, concurrentHashTable_iterator *iter) {
+    iter->table = table;
+    iter->current_index = 0;
+}
+
+bool concurrentHashTable_iteratorNext(concurrentHashTable_iterator *iter, const char **key, uint64_t *count) {
+    slotArray *array = iter->table->current;
+    while (iter->current_index < array->capacity) {
+        wordRecord *record = array->slots[iter->current_index++];
+        if (record != NULL && record != MOVED_SLOT) {
+            *key = record->key;
+            *count = record->count;
+            return true;
+        }
+    }
+    return false;
+}
+
+static slotArray *createArray(unsigned int capacityBits, double maxLoadFactor) {
+    slotArray *array = (slotArray *)calloc(1, sizeof(slotArray));
+    if (array == NULL) {
+        return NULL;
+    }
+    array->capacityBits = capacityBits;
+    array->capacity = (size_t)1 << capacityBits;
+    array->growThreshold = (size_t)((double)array->capacity * maxLoadFactor);
+    array->chunkCount = (array->capacity + CONCURRENTHASHTABLE_MIGRATION_CHUNK - 1) / CONCURRENTHASHTABLE_MIGRATION_CHUNK;
+    array->slots = (wordRecord **)calloc(array->capacity, sizeof(wordRecord *));
+    STATS_ALLOCATION(sizeof(slotArray) + array->capacity * sizeof(wordRecord *));
+    if (array->slots == NULL) {
+        free(array);
+        return NULL;
+    }
+    return array;
+}
+
+static size_t homeSlot(const slotArray *array, uint64_t hash) {
+    // Fibonacci hashing, as in hashTable.c
+    return (size_t)((hash * UINT64_C(0x9E3779B97F4A7C15)) >> (64u - array->capacityBits));
+}
+
+// Allocate the next array of a full one, unless another thread did; false if memory ran out
+static bool startResize(concurrentHashTable *table, slotArray *array) {
+    int idle = 0;
+    if (!__atomic_compare_exchange_n(&array->resizing, &idle, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return true; // Already started
+    }
+    slotArray *next = createArray(array->capacityBits + 1, table->maxLoadFactor);
+    if (next == NULL) {
+        __atomic_store_n(&array->resizing, 0, __ATOMIC_RELEASE); // Let a later insert try again
+        return false;
+    }
+    next->previous = array;
+    __atomic_store_n(&array->next, next, __ATOMIC_RELEASE);
+    return helpResize(table, array);
+}
+
+// Move records out of an array being replaced, and wait until all of them are moved
+static bool helpResize(concurrentHashTable *table, slotArray *array) {
+    slotArray *next;
+    while ((next = __atomic_load_n(&array->next, __ATOMIC_ACQUIRE)) == NULL) {
+        if (__atomic_load_n(&array->resizing, __ATOMIC_ACQUIRE) == 0) {
+            return false; // The allocation failed
+        }
+        sched_yield(); // Being allocated
+    }
+
+    size_t chunk;
+    while ((chunk = __atomic_fetch_add(&array->nextChunk, 1, __ATOMIC_RELAXED)) < array->chunkCount) {
+        moveChunk(array, chunk);
+        __atomic_fetch_add(&array->chunksDone, 1, __ATOMIC_RELEASE);
+    }
+    while (__atomic_load_n(&array->chunksDone, __ATOMIC_ACQUIRE) < array->chunkCount) {
+        sched_yield(); // Other threads are still moving their chunks
+    }
+
+    // The first thread to get here switches the table over
+    slotArray *expected = array;
+    if (__atomic_compare_exchange_n(&table->current, &expected, next, false, __ATOMIC_ACQ_REL,
+                                    __ATOMIC_ACQUIRE)) {
+        __atomic_fetch_add(&table->resizes, 1, __ATOMIC_RELAXED);
+    }
+    return true;
+}
+
+static void moveChunk(slotArray *array, size_t chunk) {
+    size_t end = (chunk + 1) * CONCURRENTHASHTABLE_MIGRATION_CHUNK;
+    if (end > array->capacity) {
+        end = array->capacity;
+    }
+    for (size_t i = chunk * CONCURRENTHASHTABLE_MIGRATION_CHUNK; i < end; i++) {
+        // Close empty slots to inserts, a record that beats us to the slot is moved instead
+        wordRecord *record = NULL;
+        if (!__atomic_compare_exchange_n(&array->slots[i], &record, MOVED_SLOT, false, __ATOMIC_ACQ_REL,
+                                         __ATOMIC_ACQUIRE)) {
+            placeRecord(array->next, record);
+        }
+    }
+}
+
+// Put a record in the first empty slot of its probe run, other movers may race for it
+static void placeRecord(slotArray *array, wordRecord *record) {
+    size_t mask = array->capacity - 1;
+    size_t index = homeSlot(array, record->hash);
+    while (true) {
+        wordRecord *empty = NULL;
+        if (__atomic_compare_exchange_n(&array->slots[index], &empty, record, false, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_ACQUIRE)) {
+            return;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+// The record of a key, NULL if absent, MOVED_SLOT if the search must go on in the next array
+static wordRecord *findRecord(slotArray *array, const char *key, size_t length, uint64_t hash) {
+    size_t mask = array->capacity - 1;
+    size_t index = homeSlot(array, hash);
+    for (size_t probes = 0; probes < array->capacity; probes++) {
+        wordRecord *record = __atomic_load_n(&array->slots[index], __ATOMIC_ACQUIRE);
+        if (record == NULL || record == MOVED_SLOT) {
+            return record;
+        }
+        if (record->hash == hash && record->length == length && memcmp(record->key, key, length) == 0) {
+            return record;
+        }
+        index = (index + 1) & mask;
+    }
+    return (__atomic_load_n(&array->next, __ATOMIC_ACQUIRE) != NULL) ? MOVED_SLOT : NULL;
+}
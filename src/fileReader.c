@@ -0,0 +1,306 @@
+/*
+ * Most Frequent Words - File input
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "fileReader_cfg.h"
+#include "fileReader.h"
+#include "streamReader.h"
+
+#ifdef _WIN32
+
+// No mmap/read() on Windows builds, stream the file through stdio instead
+bool fileReader_scanFile(const char *path, wordScanner *scanner) {
+    FILE *fptr = fopen(path, "rb");
+    if (fptr == NULL) {
+        return false;
+    }
+
+    char *buffer = malloc(FILEREADER_BUFFER_SIZE);
+    if (buffer == NULL) {
+        fclose(fptr);
+        return false;
+    }
+
+    bool ok = true;
+    size_t bytesRead;
+    while (ok && (bytesRead = fread(buffer, 1, FILEREADER_BUFFER_SIZE, fptr)) > 0) {
+        ok = wordScanner_feed(scanner, buffer, bytesRead);
+    }
+    ok = ok && !ferror(fptr) && wordScanner_finish(scanner);
+
+    free(buffer);
+    fclose(fptr);
+    return ok;
+}
+
+bool fileReader_map(const char *path, fileReader_mapping *mapping) {
+    (void)path;
+    mapping->data = NULL;
+    mapping->length = 0;
+    return false; // Callers fall back to fileReader_scanFile()
+}
+
+void fileReader_unmap(fileReader_mapping *mapping) {
+    mapping->data = NULL;
+    mapping->length = 0;
+}
+
+#else
+
+// Map fd read-only if it is a non-empty regular file
+static bool mapFd(int fd, fileReader_mapping *mapping) {
+    struct stat info;
+
+    mapping->data = NULL;
+    mapping->length = 0;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0) {
+        return false;
+    }
+
+    void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    // Files are scanned in a single front-to-back pass (per thread)
+    posix_madvise(data, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+
+    mapping->data = (const char *)data;
+    mapping->length = (size_t)info.st_size;
+    return true;
+}
+
+bool fileReader_scanFile(const char *path, wordScanner *scanner) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool ok;
+    fileReader_mapping mapping;
+    if (mapFd(fd, &mapping) && !streamReader_isCompressed(mapping.data, mapping.length)) {
+        ok = wordScanner_feed(scanner, mapping.data, mapping.length) &&
+             wordScanner_finish(scanner);
+        fileReader_unmap(&mapping);
+    } else {
+        fileReader_unmap(&mapping); // Compressed files are inflated while they are read
+        // Pipes, devices, empty or unmappable files, read on a thread of their own
+        ok = streamReader_scanFd(fd, scanner, NULL);
+    }
+
+    close(fd);
+    return ok;
+}
+
+bool fileReader_map(const char *path, fileReader_mapping *mapping) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        mapping->data = NULL;
+        mapping->length = 0;
+        return false;
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    bool mapped = mapFd(fd, mapping);
+    close(fd);
+    return mapped;
+}
+
+void fileReader_unmap(fileReader_mapping *mapping) {
+    if (mapping->data != NULL) {
+        munmap((void *)mapping->data, mapping->length);
+    }
+    mapping->data = NULL;
+    mapping->length = 0;
+}
+
+#endif
+
+/*========================================================== */
+/*======================= File lists ======================= */
+/*========================================================== */
+
+// Append a path to the list, the list takes ownership of it
+static bool addPath(fileReader_fileList *list, char *path) {
+    if (path == NULL) {
+        return false;
+    }
+    if (list->count == list->capacity) {
+        size_t newCapacity = (list->capacity == 0) ? 64 : list->capacity * 2;
+        char **grown = realloc(list->paths, newCapacity * sizeof(char *));
+        if (grown == NULL) {
+            free(path);
+            return false;
+        }
+        list->paths = grown;
+        list->capacity = newCapacity;
+    }
+    list->paths[list->count++] = path;
+    return true;
+}
+
+static char *joinPath(const char *directory, const char *name) {
+    size_t directoryLength = strlen(directory);
+    size_t nameLength = strlen(name);
+    char *path = malloc(directoryLength + nameLength + 2);
+    if (path == NULL) {
+        return NULL;
+    }
+    memcpy(path, directory, directoryLength);
+    // Roots given with a trailing separator are not doubled
+    if (directoryLength > 0 && directory[directoryLength - 1] != '/' && directory[directoryLength - 1] != '\\') {
+        path[directoryLength++] = '/';
+    }
+    memcpy(path + directoryLength, name, nameLength + 1);
+    return path;
+}
+
+static int cmpPath(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+#ifdef _WIN32
+
+static bool isDirectory(const char *path, bool followLinks) {
+    DWORD attributes = GetFileAttributesA(path);
+    if (attributes == INVALID_FILE_ATTRIBUTES || !(attributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        return false;
+    }
+    // Junctions and directory links are not followed below the roots
+    return followLinks || !(attributes & FILE_ATTRIBUTE_REPARSE_POINT);
+}
+
+// Child paths of a directory, false if it cannot be opened
+static bool readDirectory(const char *directory, fileReader_fileList *children, bool *ok) {
+    char *pattern = joinPath(directory, "*");
+    if (pattern == NULL) {
+        *ok = false;
+        return false;
+    }
+    WIN32_FIND_DATAA entry;
+    HANDLE find = FindFirstFileA(pattern, &entry);
+    free(pattern);
+    if (find == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    do {
+        if (strcmp(entry.cFileName, ".") != 0 && strcmp(entry.cFileName, "..") != 0) {
+            *ok = *ok && addPath(children, joinPath(directory, entry.cFileName));
+        }
+    } while (*ok && FindNextFileA(find, &entry));
+    FindClose(find);
+    return true;
+}
+
+// Regular files, and links resolving to them
+static bool isListedFile(const char *path) {
+    DWORD attributes = GetFileAttributesA(path);
+    return attributes != INVALID_FILE_ATTRIBUTES && !(attributes & FILE_ATTRIBUTE_DIRECTORY);
+}
+
+#else
+
+static bool isDirectory(const char *path, bool followLinks) {
+    struct stat info;
+    int status = followLinks ? stat(path, &info) : lstat(path, &info);
+    return status == 0 && S_ISDIR(info.st_mode);
+}
+
+// Child paths of a directory, false if it cannot be opened
+static bool readDirectory(const char *directory, fileReader_fileList *children, bool *ok) {
+    DIR *dir = opendir(directory);
+    if (dir == NULL) {
+        return false;
+    }
+    struct dirent *entry;
+    while (*ok && (entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+            *ok = addPath(children, joinPath(directory, entry->d_name));
+        }
+    }
+    closedir(dir);
+    return true;
+}
+
+// Regular files, and links resolving to them
+static bool isListedFile(const char *path) {
+    struct stat info;
+    return stat(path, &info) == 0 && S_ISREG(info.st_mode);
+}
+
+#endif
+
+static bool walkDirectory(const char *directory, fileReader_fileList *list) {
+    fileReader_fileList children = { NULL, 0, 0 };
+    bool ok = true;
+
+    if (!readDirectory(directory, &children, &ok)) {
+        // Listed anyway, reading it reports the error
+        return addPath(list, strdup(directory));
+    }
+    qsort(children.paths, children.count, sizeof(char *), cmpPath);
+
+    for (size_t i = 0; i < children.count; i++) {
+        char *child = children.paths[i];
+        children.paths[i] = NULL;
+        if (!ok) {
+            free(child);
+        } else if (isDirectory(child, false)) {
+            ok = walkDirectory(child, list);
+            free(child);
+        } else if (isListedFile(child)) {
+            ok = addPath(list, child);
+        } else {
+            free(child); // Sockets, fifos, devices and dangling links
+        }
+    }
+    fileReader_freeFileList(&children);
+    return ok;
+}
+
+bool fileReader_listFiles(const char *const *roots, size_t rootCount, fileReader_fileList *list) {
+    list->paths = NULL;
+    list->count = 0;
+    list->capacity = 0;
+
+    bool ok = true;
+    for (size_t i = 0; ok && i < rootCount; i++) {
+        if (isDirectory(roots[i], true)) {
+            ok = walkDirectory(roots[i], list);
+        } else {
+            ok = addPath(list, strdup(roots[i]));
+        }
+    }
+    if (!ok) {
+        fileReader_freeFileList(list);
+    }
+    return ok;
+}
+
+void fileReader_freeFileList(fileReader_fileList *list) {
+    for (size_t i = 0; i < list->count; i++) {
+        free(list->paths[i]);
+    }
+    free(list->paths);
+    list->paths = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Most Frequent Words - String hash functions
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "hashFunctions.h"
+
+// wyhash default secret, odd 64-bit constants with balanced bits
+static const uint64_t wySecret[4] = {
+    UINT64_C(0x2d358dccaa6c78a5), UINT64_C(0x8bb84b93962eacc9),
+    UINT64_C(0x4b33a62ed433d4a3), UINT64_C(0x4d5a2da51de1aa47)
+};
+
+/*========================================================== */
+/*==================== Private Functions =================== */
+/*========================================================== */
+
+// 64x64 -> 128 bit multiplication, low half in *a and high half in *b
+static inline void multiply128(uint64_t *a, uint64_t *b) {
+#ifdef __SIZEOF_INT128__
+    __uint128_t product = (__uint128_t)*a * *b;
+    *a = (uint64_t)product;
+    *b = (uint64_t)(product >> 64);
+#else
+    uint64_t aHigh = *a >> 32, aLow = (uint32_t)*a;
+    uint64_t bHigh = *b >> 32, bLow = (uint32_t)*b;
+    uint64_t highHigh = aHigh * bHigh, highLow = aHigh * bLow;
+    uint64_t lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+    uint64_t middle = (lowLow >> 32) + (uint32_t)highLow + (uint32_t)lowHigh;
+    *a = (middle << 32) | (uint32_t)lowLow;
+    *b = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+}
+
+static inline uint64_t mix(uint64_t a, uint64_t b) {
+    multiply128(&a, &b);
+    return a ^ b;
+}
+
+// Unaligned native-order loads, memcpy compiles to a single mov
+static inline uint64_t read64(const unsigned char *p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t read32(const unsigned char *p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// splitmix64 finalizer, spreads a weak seed over all 64 bits
+static uint64_t finalizeSeed(uint64_t x) {
+    x ^= x >> 30;
+    x *= UINT64_C(0xbf58476d1ce4e5b9);
+    x ^= x >> 27;
+    x *= UINT64_C(0x94d049bb133111eb);
+    return x ^ (x >> 31);
+}
+
+/*========================================================== */
+/*==================== Public Functions ==================== */
+/*========================================================== */
+uint64_t hashFunctions_djb2(const char *key, size_t length, uint64_t seed) {
+    uint64_t hash = UINT64_C(5381) ^ seed;
+    const unsigned char *p = (const unsigned char *)key;
+
+    for (size_t i = 0; i < length; i++) {
+        hash = ((hash << 5) + hash) + p[i]; // hash * 33 + c
+    }
+    return hash;
+}
+
+uint64_t hashFunctions_fnv1a(const char *key, size_t length, uint64_t seed) {
+    uint64_t hash = UINT64_C(0xcbf29ce484222325) ^ seed;
+    const unsigned char *p = (const unsigned char *)key;
+
+    for (size_t i = 0; i < length; i++) {
+        hash ^= p[i];
+        hash *= UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+uint64_t hashFunctions_wyhash(const char *key, size_t length, uint64_t seed) {
+    const unsigned char *p = (const unsigned char *)key;
+    uint64_t a;
+    uint64_t b;
+
+    seed ^= mix(seed ^ wySecret[0], wySecret[1]);
+    if (length <= 16) {
+        if (length >= 4) {
+            // Two overlapping pairs of 4-byte reads cover 4..16 bytes
+            size_t shift = (length >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + shift);
+            b = (read32(p + length - 4) << 32) | read32(p + length - 4 - shift);
+        } else if (length > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | p[length - 1];
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t remaining = length;
+        if (remaining >= 48) {
+            // Three independent lanes keep the multipliers busy on long keys
+            uint64_t lane1 = seed;
+            uint64_t lane2 = seed;
+            do {
+                seed = mix(read64(p) ^ wySecret[1], read64(p + 8) ^ seed);
+                lane1 = mix(read64(p + 16) ^ wySecret[2], read64(p + 24) ^ lane1);
+                lane2 = mix(read64(p + 32) ^ wySecret[3], read64(p + 40) ^ lane2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining >= 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = mix(read64(p) ^ wySecret[1], read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        // Last 16 bytes of the key, overlapping what was already mixed
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+
+    a ^= wySecret[1];
+    b ^= seed;
+    multiply128(&a, &b);
+    return mix(a ^ wySecret[0] ^ length, b ^ wySecret[1]);
+}
+
+hashFunctions_fn hashFunctions_get(hashFunctions_algorithm algorithm) {
+    switch (algorithm) {
+        case HASH_FUNCTION_DJB2:
+            return hashFunctions_djb2;
+        case HASH_FUNCTION_FNV1A:
+            return hashFunctions_fnv1a;
+        default:
+            return hashFunctions_wyhash;
+    }
+}
+
+const char *hashFunctions_name(hashFunctions_algorithm algorithm) {
+    switch (algorithm) {
+        case HASH_FUNCTION_DJB2:
+            return "djb2";
+        case HASH_FUNCTION_FNV1A:
+            return "fnv1a";
+        case HASH_FUNCTION_DEFAULT:
+        case HASH_FUNCTION_WYHASH:
+            return "wyhash";
+        default:
+            return "unknown";
+    }
+}
+
+uint64_t hashFunctions_randomSeed(void) {
+    uint64_t seed = 0;
+
+    FILE *random = fopen("/dev/urandom", "rb");
+    if (random != NULL) {
+        size_t got = fread(&seed, sizeof(seed), 1, random);
+        fclose(random);
+        if (got == 1) {
+            return seed;
+        }
+    }
+
+    // No urandom (chroot, Windows): the clock and ASLR'd stack and code addresses
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    seed = (uint64_t)ts.tv_sec * UINT64_C(1000000007) ^ (uint64_t)ts.tv_nsec;
+    seed ^= (uint64_t)(uintptr_t)&seed ^ ((uint64_t)(uintptr_t)&wySecret << 17);
+    return finalizeSeed(seed);
+}
@@ -5,57 +5,223 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include "hashTable_cfg.h"
 #include "hashTable.h"
+#include "stats.h"
+
+// Smallest number of slots a table is created with
+#define HASHTABLE_MIN_CAPACITY_BITS (3u)
+// Largest load factor accepted from a configuration, probing degrades past it
+#define HASHTABLE_MAX_ALLOWED_LOAD_FACTOR (0.95)
+// 64-bit words an inline key is compared in
+#define HASHTABLE_INLINE_KEY_WORDS (HASHTABLE_INLINE_KEY_SIZE / 8)
+
+// Inline keys are compared and padded in whole 64-bit words
+typedef char hashTable_inlineKeySizeCheck[(HASHTABLE_INLINE_KEY_SIZE >= 8 &&
+                                           HASHTABLE_INLINE_KEY_SIZE % 8 == 0) ? 1 : -1];
 
 /*========================================================== */
 /*============== Private Function Declarations ============= */
 /*========================================================== */
 
 /**
- * @brief DJB2 hash function for string keys
- * 
- * This is a simple hash function from Daniel J. Bernstein. It uses the magic
- * number 5381 (which is a prime) and multiplies by 33 (shifting left by 5 and
- * adding) for each character in the string.
- * 
- * @param str The null-terminated string to hash
- * 
- * @return The hash value as an unsigned long
- * 
+ * @brief Hashes a key with the table's hash function and seed
+ *
+ * @param ht Pointer to the hash table
+ * @param key The key bytes to hash (need not be null-terminated)
+ * @param length Number of bytes to hash
+ *
+ * @return The hash value, stored in the entry and compared before the key
+ *
  * @note This is a private function, only accessible within this file
- * @note The function assumes str is not NULL (caller responsibility)
- * 
- * @algorithm
- *   hash = 5381
- *   for each character c in str:
- *     hash = hash * 33 + c
- * 
- * @example
- *   unsigned long hash = hash_djb2("hello");
  */
-static unsigned long hash_djb2(const char *str);
+static inline size_t hashKey(const hashTable* ht, const char* key, size_t length);
 
 /**
- * @brief Inserts a new key-value pair into the hash table at the specified index
+ * @brief Maps a hash value to its home slot in the entries array
  * 
- * This function creates a new hash table entry for the given key and value,
- * and inserts it into the linked list at the specified index in the hash table.
+ * Uses Fibonacci hashing (multiplication by 2^64 / golden ratio, keeping the
+ * top capacity_bits bits) so that every bit of the hash influences the slot,
+ * which matters for DJB2 and FNV-1a whose low bits are poorly mixed.
+ *
+ * @param ht Pointer to the hash table
+ * @param hash Full hash value of the key
+ *
+ * @return Index of the home slot, in [0, capacity)
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static size_t homeSlot(const hashTable* ht, size_t hash);
+
+/**
+ * @brief Returns the entry header of the slot at the given index
+ *
+ * Slots are slot_size bytes apart, the entry header is at the start of the
+ * slot and the value follows it.
+ *
+ * @param ht Pointer to the hash table
+ * @param index Slot index, in [0, capacity)
+ *
+ * @return Pointer to the entry header of the slot
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static inline ht_entry* slotAt(const hashTable* ht, size_t index);
+
+/**
+ * @brief Returns the value of an entry as seen by callers
+ *
+ * @param ht Pointer to the hash table
+ * @param entry Pointer to an occupied entry
+ *
+ * @return Pointer to the inline value bytes for inline tables, the stored
+ *         void* pointer otherwise
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static inline void* entryValue(const hashTable* ht, ht_entry* entry);
+
+/**
+ * @brief Stores a value into an entry's slot
+ *
+ * @param ht Pointer to the hash table
+ * @param entry Pointer to the entry
+ * @param value value_size bytes to copy for inline tables, the pointer to
+ *              store otherwise
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static inline void setEntryValue(const hashTable* ht, ht_entry* entry, const void* value);
+
+/**
+ * @brief Tells whether a key of the given length is stored in its slot
+ *
+ * @param ht Pointer to the hash table
+ * @param length Length of the key in bytes
+ *
+ * @return true for inline_keys tables and keys shorter than
+ *         HASHTABLE_INLINE_KEY_SIZE, false when the key is allocated apart
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static inline bool isInlineKey(const hashTable* ht, size_t length);
+
+/**
+ * @brief Copies a whole slot, entry header, value and inline key
+ *
+ * The key pointer of an inline key is pointed at the copy of its bytes, so
+ * every slot move (placement, resize, backward shift) must go through here.
+ *
+ * @param ht Pointer to the hash table
+ * @param dst Slot receiving the copy (in the entries array or scratch space)
+ * @param src Occupied slot to copy
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static inline void moveSlot(const hashTable* ht, void* dst, const void* src);
+
+/**
+ * @brief Compares the inline key of an entry with a zero padded probe key
+ *
+ * @param ht Pointer to the hash table
+ * @param entry Pointer to an entry holding an inline key of the probe's length
+ * @param probe The searched key, zero padded to HASHTABLE_INLINE_KEY_SIZE bytes
+ *
+ * @return true if the keys are equal
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static inline bool inlineKeyEquals(const hashTable* ht, const ht_entry* entry, const uint64_t* probe);
+
+/**
+ * @brief Finds the slot holding the given key
+ *
+ * Probes linearly from the key's home slot. Because entries are kept in
+ * Robin Hood order, the search stops as soon as it reaches an empty slot or
+ * an entry that is closer to its own home slot than the key would be.
+ * Inline keys are compared in the slot, without following entry->key.
+ *
+ * @param ht Pointer to the hash table
+ * @param key The key bytes (need not be null-terminated)
+ * @param length Length of the key in bytes
+ * @param hash Full hash value of the key
+ *
+ * @return Pointer to the entry holding the key, or NULL if not found
+ *
+ * @note Counts the search in ht->stats when built with STATS_ENABLED
+ * @note This is a private function, only accessible within this file
+ */
+static ht_entry* findEntry(hashTable* ht, const char* key, size_t length, size_t hash);
+
+/**
+ * @brief Inserts a new key-value pair into the hash table
+ *
+ * This function copies the key into a new null-terminated string (taken from
+ * the table's arena when it has one, or into the slot for an inline key), grows the
+ * table if the insertion would exceed max_load_factor, and places the entry
+ * using Robin Hood probing.
  * 
  * @param ht Pointer to the hash table
- * @param key The key string (must be null-terminated)
+ * @param key The key bytes (need not be null-terminated)
+ * @param length Length of the key in bytes
  * @param value Pointer to the value data
- * @param index The index in the hash table entries array to insert into
+ * @param hash Full hash value of the key
  * 
  * @return Pointer to the inserted value on success, NULL on failure
  * 
  * @note This is a private function, only accessible within this file
- * @note The function assumes ht and key are not NULL (caller responsibility)
+ * @note The function assumes ht and key are not NULL and that the key is not
+ *       already present (caller responsibility)
+ */
+static void* insertElement (hashTable* ht, const char* key, size_t length, const void* value, size_t hash);
+
+/**
+ * @brief Places a slot into the entries array using Robin Hood probing
+ *
+ * Walks from the entry's home slot and swaps it with any resident entry
+ * that is closer to its own home slot, so probe lengths stay balanced.
+ * Whole slots (entry header, value and inline key) are moved through the
+ * scratch space.
+ *
+ * @param ht Pointer to the hash table (must have at least one free slot)
+ * @param entry The slot to place, copied (may be the first scratch slot)
+ *
+ * @return Pointer to the slot the entry was placed in
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static ht_entry* placeEntry(hashTable* ht, const ht_entry* entry);
+
+/**
+ * @brief Doubles the capacity of the entries array and re-places every entry
+ *
+ * Entries are moved using their stored hash, so no key is rehashed or
+ * compared during the resize.
+ *
+ * @param ht Pointer to the hash table
+ *
+ * @return true on success, false if the new array could not be allocated
+ *         (the table is left unchanged in that case)
+ *
+ * @note This is a private function, only accessible within this file
+ */
+static bool resize(hashTable* ht);
+
+/**
+ * @brief Computes the length at which a table of the given capacity must grow
+ *
+ * @param capacity Number of slots in the entries array
+ * @param maxLoadFactor Maximum allowed load factor
+ *
+ * @return Largest length allowed for this capacity, always below capacity
+ *
+ * @note This is a private function, only accessible within this file
  */
-static void* insertElement (hashTable* ht, const char* key, const void* value, size_t index);
+static size_t growThreshold(size_t capacity, double maxLoadFactor);
 
 /*========================================================== */
 /*==================== Public Functions ==================== */
@@ -64,6 +230,12 @@ hashTable* hashTable_create(hashTable_config* config) {
     
     size_t tableCapacity;
     double tableMaxLoadFactor;
+    bool useArena;
+    size_t arenaBlockSize;
+    size_t valueSize;
+    hashFunctions_algorithm hashFunction;
+    bool randomSeed;
+    bool inlineKeys;
 
     // Check if custom configuration is provided
     if (config == NULL)
@@ -71,16 +243,66 @@ hashTable* hashTable_create(hashTable_config* config) {
         // Use default configuration values when no config is provided
         tableCapacity = (size_t)HASHTABLE_DEFAULT_CAPACITY;
         tableMaxLoadFactor = (double)HASHTABLE_DEFAULT_MAX_LOAD_FACTOR;
+        useArena = HASHTABLE_DEFAULT_USE_ARENA;
+        arenaBlockSize = 0;
+        valueSize = (size_t)HASHTABLE_DEFAULT_VALUE_SIZE;
+        hashFunction = HASHTABLE_DEFAULT_HASH_FUNCTION;
+        randomSeed = HASHTABLE_DEFAULT_RANDOM_SEED;
+        inlineKeys = HASHTABLE_DEFAULT_INLINE_KEYS;
     }
     else 
     {
         // Use provided configuration values
         tableCapacity = config->initial_capacity;
         tableMaxLoadFactor = config->max_load_factor;
+        useArena = config->use_arena;
+        arenaBlockSize = config->arena_block_size;
+        valueSize = config->value_size;
+        hashFunction = config->hash_function;
+        randomSeed = config->random_seed;
+        inlineKeys = config->inline_keys;
+    }
+
+    // Fall back to defaults for values open addressing cannot work with
+    if (tableCapacity == 0)
+    {
+        tableCapacity = (size_t)HASHTABLE_DEFAULT_CAPACITY;
+    }
+    if (!(tableMaxLoadFactor > 0.0 && tableMaxLoadFactor <= HASHTABLE_MAX_ALLOWED_LOAD_FACTOR))
+    {
+        tableMaxLoadFactor = (double)HASHTABLE_DEFAULT_MAX_LOAD_FACTOR;
+    }
+    if (hashFunction == HASH_FUNCTION_DEFAULT)
+    {
+        hashFunction = HASHTABLE_DEFAULT_HASH_FUNCTION;
+    }
+
+    // A slot holds the entry header followed by the value, padded so every
+    // slot (and thus every inline value) stays 8-byte aligned, then the
+    // inline key bytes if the table has them
+    size_t payloadSize = (valueSize > 0) ? valueSize : sizeof(void*);
+    if (payloadSize > SIZE_MAX / 4 - sizeof(ht_entry) - HASHTABLE_INLINE_KEY_SIZE)
+    {
+        return NULL; // Value too large to lay out slots
+    }
+    size_t slotSize = (sizeof(ht_entry) + payloadSize + 7u) & ~(size_t)7u;
+    size_t keyOffset = 0;
+    if (inlineKeys)
+    {
+        keyOffset = slotSize;
+        slotSize += HASHTABLE_INLINE_KEY_SIZE;
+    }
+
+    // Round the capacity up to a power of two
+    unsigned int capacityBits = HASHTABLE_MIN_CAPACITY_BITS;
+    while (((size_t)1 << capacityBits) < tableCapacity)
+    {
+        capacityBits++;
     }
 
     // Allocate memory for the hash table structure
     hashTable *ht = malloc(sizeof(hashTable));
+    STATS_ALLOCATION(sizeof(hashTable));
 
     // Check if memory allocation failed
     if (ht == NULL)
@@ -89,22 +311,45 @@ hashTable* hashTable_create(hashTable_config* config) {
     }
     
     // Initialize hash table properties
-    ht->capacity = tableCapacity;               // Set table capacity
-    ht->max_load_factor = tableMaxLoadFactor;   // Set maximum load factor
-    ht->length = 0;                             // Initialize current size to 0
+    ht->capacity_bits = capacityBits;                       // Set log2 of the capacity
+    ht->capacity = (size_t)1 << capacityBits;               // Set table capacity
+    ht->max_load_factor = tableMaxLoadFactor;               // Set maximum load factor
+    ht->length = 0;                                         // Initialize current size to 0
+    ht->grow_threshold = growThreshold(ht->capacity, tableMaxLoadFactor);
+    ht->value_size = valueSize;                             // Set inline value size
+    ht->slot_size = slotSize;                               // Set bytes per slot
+    ht->key_offset = keyOffset;                             // Set where inline keys start
+    ht->hash_function = hashFunctions_get(hashFunction);    // Set key hash function
+    ht->hash_seed = randomSeed ? hashFunctions_randomSeed() : 0;
+    memset(&ht->stats, 0, sizeof(ht->stats));               // No operations counted yet
     
-    // Allocate and zero-initialize the entries array
-    ht->entries = (ht_entry**)calloc(ht->capacity, sizeof(ht_entry*));
+    // Allocate and zero-initialize the entries array (a NULL key marks an empty slot)
+    ht->entries = (unsigned char*)calloc(ht->capacity, slotSize);
+    ht->scratch = (unsigned char*)malloc(2 * slotSize);
+    STATS_ALLOCATION(ht->capacity * slotSize);
+    STATS_ALLOCATION(2 * slotSize);
     
     // Check if entries allocation failed
-    if (ht->entries == NULL)
+    if (ht->entries == NULL || ht->scratch == NULL)
     {
+        free(ht->entries);
+        free(ht->scratch);
         free(ht);    // Clean up previously allocated hash table
         return NULL; // Return NULL on allocation failure
     }
-    // Initialize each entry in the entries array
-    for (size_t i = 0; i < ht->capacity; i++) {
-        ht->entries[i] = NULL; // Set each slot to NULL (empty)
+
+    // Create the arena keys and counters are carved from, if requested
+    ht->arena = NULL;
+    if (useArena)
+    {
+        ht->arena = arena_create(arenaBlockSize);
+        if (ht->arena == NULL)
+        {
+            free(ht->entries);
+            free(ht->scratch);
+            free(ht);
+            return NULL; // Return NULL on allocation failure
+        }
     }
 
     return ht; // Return successfully created hash table
@@ -116,206 +361,527 @@ void hashTable_destroy(hashTable* ht)
     if (ht == NULL) {
         return; // Nothing to destroy if pointer is NULL
     }
+
+#if STATS_ENABLED
+    // Hand the counters over before they are lost
+    hashTable_stats stats;
+    hashTable_getStats(ht, &stats);
+    stats_addTable(&stats);
+#endif
     
-    // Iterate through all slots in the hash table
-    for (size_t i = 0; i < ht->capacity; i++) {
-        ht_entry* entry = ht->entries[i];
-        ht_entry* next;
-        // Free all entries in the linked list at this slot
-        while (entry != NULL) {
-            // Store pointer to next entry
-            next = entry->next; 
-            // Free the key string if dynamically allocated
-            free((void*)entry->key);
-            // Free the value pointer if dynamically allocated
-            free(entry->value);
-            // Free the entry structure itself
-            free(entry);
-            // Move to the next entry
-            entry = next; 
+    if (ht->arena != NULL) {
+        // Keys and counters live in the arena, release it a block at a time
+        arena_destroy(ht->arena);
+    } else {
+        // Iterate through all slots in the hash table
+        for (size_t i = 0; i < ht->capacity; i++) {
+            ht_entry* entry = slotAt(ht, i);
+            if (entry->key != NULL) {
+                // Free the key string if dynamically allocated (inline keys live in the slot)
+                if (!isInlineKey(ht, entry->length)) {
+                    free((void*)entry->key);
+                }
+                // Free the value pointer if dynamically allocated (inline values live in the slot)
+                if (ht->value_size == 0) {
+                    free(entryValue(ht, entry));
+                }
+            }
         }
     }
 
     // Free the entries array that holds all the hash table slots
     free(ht->entries);
+    free(ht->scratch);
     // Finally, free the hash table structure itself
     free(ht);
 }
 
 void* hashTable_lookup(hashTable* ht, const char* key) {
-    // Compute the hash value for the given key
-    unsigned long hashValue = hash_djb2(key);
-    size_t index = hashValue % ht->capacity;
+    return hashTable_lookupLen(ht, key, strlen(key));
+}
 
-    //declare current entry pointer
-    ht_entry *currentEntry = ht->entries[index];
+void* hashTable_lookupLen(hashTable* ht, const char* key, size_t length) {
+    // Compute the hash value for the given key
+    size_t hashValue = hashKey(ht, key, length);
 
-    // Traverse the linked list at this index to find the key
-    while (currentEntry != NULL)
-    {
-        if (strcmp(key, currentEntry->key) == 0) 
-        {
-            return currentEntry->value;
-        }
-        // Move to the next entry in the linked list
-        currentEntry = currentEntry->next;
-    }
+    ht_entry* entry = findEntry(ht, key, length, hashValue);
 
-    return NULL; // Key not found
+    return (entry != NULL) ? entryValue(ht, entry) : NULL; // NULL if key not found
 }
 
 void* hashTable_insert(hashTable* ht, const char* key, const void* value) {
+    size_t length = strlen(key);
     // Compute the hash value for the given key
-    unsigned long hashValue = hash_djb2(key);
-    size_t index = hashValue % ht->capacity;
-
-    //declare current entry pointer
-    ht_entry *currentEntry = ht->entries[index];
+    size_t hashValue = hashKey(ht, key, length);
 
-    while (currentEntry != NULL) {
+    ht_entry* entry = findEntry(ht, key, length, hashValue);
 
-        if (strcmp(key, currentEntry->key) == 0) 
-        {
-            // Key already exists, update the value
-            currentEntry->value = (void*)value;
-            return currentEntry->value;
-        }
-        // Move to the next entry in the linked list
-        currentEntry = currentEntry->next;
+    if (entry != NULL)
+    {
+        // Key already exists, update the value
+        setEntryValue(ht, entry, value);
+        return entryValue(ht, entry);
     }
     // Key does not exist, create a new entry
-    return insertElement(ht, key, value, index);
+    return insertElement(ht, key, length, value, hashValue);
 }
 
 void* hashTable_incrementOrInsert(hashTable* ht, const char* key) {
+    return hashTable_incrementOrInsertLen(ht, key, strlen(key));
+}
+
+void* hashTable_incrementOrInsertLen(hashTable* ht, const char* key, size_t length) {
     // Compute the hash value for the given key
-    unsigned long hashValue = hash_djb2(key);
-    size_t index = hashValue % ht->capacity;
+    return hashTable_incrementOrInsertHashed(ht, key, length, hashKey(ht, key, length));
+}
 
-    //declare current entry pointer
-    ht_entry *currentEntry = ht->entries[index];
+size_t hashTable_hashKey(const hashTable* ht, const char* key, size_t length) {
+    return hashKey(ht, key, length);
+}
+
+void* hashTable_incrementOrInsertHashed(hashTable* ht, const char* key, size_t length, size_t hashValue) {
+    // Inline tables can only hold 64-bit counters
+    if (ht->value_size != 0 && ht->value_size != sizeof(uint64_t)) {
+        return NULL;
+    }
 
-    while (currentEntry != NULL) {
+    ht_entry* entry = findEntry(ht, key, length, hashValue);
 
-        if (strcmp(key, currentEntry->key) == 0) 
+    if (ht->value_size != 0)
+    {
+        // The counter lives in the slot, no allocation either way
+        if (entry != NULL)
         {
-            // Key already exists, increment the value
-            int* value = (int *)(currentEntry->value);
-            (*value)++;
-            return currentEntry->value;
+            uint64_t* counter = (uint64_t *)entryValue(ht, entry);
+            (*counter)++;
+            return counter;
         }
-        // Move to the next entry in the linked list
-        currentEntry = currentEntry->next;
+        uint64_t one = 1;
+        return insertElement(ht, key, length, &one, hashValue);
+    }
+
+    if (entry != NULL)
+    {
+        // Key already exists, increment the value
+        int* value = (int *)entryValue(ht, entry);
+        (*value)++;
+        return value;
     }
     // Key does not exist, create a new entry with initial value 1
-    int* initialValue = (int *)malloc(sizeof(int));
+    int* initialValue;
+    if (ht->arena != NULL) {
+        initialValue = (int *)arena_alloc(ht->arena, sizeof(int), sizeof(int));
+    } else {
+        initialValue = (int *)malloc(sizeof(int));
+        STATS_ALLOCATION(sizeof(int));
+    }
+    if (initialValue == NULL) {
+        return NULL; // Memory allocation failed
+    }
     *initialValue = 1;
-    return insertElement(ht, key, (void *)initialValue, index);
+    void* inserted = insertElement(ht, key, length, (void *)initialValue, hashValue);
+    if (inserted == NULL && ht->arena == NULL) {
+        free(initialValue); // Arena memory is reclaimed with the arena
+    }
+    return inserted;
+
+}
+
+void* hashTable_addCountLen(hashTable* ht, const char* key, size_t length, uint64_t count) {
+    // Only 64-bit counters kept in the slots can be added to
+    if (ht->value_size != sizeof(uint64_t)) {
+        return NULL;
+    }
+    // Compute the hash value for the given key
+    size_t hashValue = hashKey(ht, key, length);
+
+    ht_entry* entry = findEntry(ht, key, length, hashValue);
 
+    if (entry != NULL)
+    {
+        uint64_t* counter = (uint64_t *)entryValue(ht, entry);
+        *counter += count;
+        return counter;
+    }
+    // Key does not exist, the new counter starts from count
+    return insertElement(ht, key, length, &count, hashValue);
 }
 
 void* hashTable_updateOrInsert(hashTable* ht, const char* key, 
-                               void* defaultValue, 
-                               void* (*updateFunc)(void* existingValue)) {
-    // TODO: implement the function hashTable_updateOrInsert
-    return NULL;
+                               const void* defaultValue, 
+                               void (*updateFunc)(void* existingValue, void* context),
+                               void* context) {
+    size_t length = strlen(key);
+    // Compute the hash value for the given key
+    size_t hashValue = hashKey(ht, key, length);
+
+    ht_entry* entry = findEntry(ht, key, length, hashValue);
+
+    if (entry != NULL)
+    {
+        // Key already exists, let the caller update the value in place
+        void* value = entryValue(ht, entry);
+        updateFunc(value, context);
+        return value;
+    }
+    // Key does not exist, create a new entry holding the default value
+    return insertElement(ht, key, length, defaultValue, hashValue);
+}
+
+void* hashTable_findOrInsertLen(hashTable* ht, const char* key, size_t length, const void* defaultValue) {
+    // Compute the hash value for the given key
+    size_t hashValue = hashKey(ht, key, length);
+
+    ht_entry* entry = findEntry(ht, key, length, hashValue);
+
+    if (entry != NULL)
+    {
+        return entryValue(ht, entry); // Key already exists, the caller updates it
+    }
+    // Key does not exist, create a new entry holding the default value
+    return insertElement(ht, key, length, defaultValue, hashValue);
+}
+
+bool hashTable_delete(hashTable* ht, const char* key) {
+    return hashTable_deleteLen(ht, key, strlen(key));
+}
+
+bool hashTable_deleteLen(hashTable* ht, const char* key, size_t length) {
+    // Compute the hash value for the given key
+    size_t hashValue = hashKey(ht, key, length);
+
+    ht_entry* entry = findEntry(ht, key, length, hashValue);
+
+    if (entry == NULL)
+    {
+        return false; // Key not present
+    }
+
+    if (ht->arena == NULL)
+    {
+        // Free what the table owns, as hashTable_destroy() would
+        if (!isInlineKey(ht, entry->length)) {
+            free((void*)entry->key);
+        }
+        if (ht->value_size == 0) {
+            free(entryValue(ht, entry));
+        }
+    }
+
+    // Shift the rest of the probe run back one slot, until an empty slot or
+    // an entry already in its home slot ends it
+    size_t mask = ht->capacity - 1;
+    size_t index = (size_t)((unsigned char*)entry - ht->entries) / ht->slot_size;
+    while (true)
+    {
+        size_t next = (index + 1) & mask;
+        ht_entry* nextEntry = slotAt(ht, next);
+        if (nextEntry->key == NULL || homeSlot(ht, nextEntry->hash) == next) {
+            break;
+        }
+        moveSlot(ht, slotAt(ht, index), nextEntry);
+        index = next;
+    }
+    memset(slotAt(ht, index), 0, ht->slot_size); // A NULL key marks the slot empty
+
+    ht->length--; // Decrement the number of items in the hash table
+    STATS_ADD(ht->stats.deletes, 1);
+    return true;
 }
 
 void hashTable_initIterator(hashTable* ht, hashTable_iterator* iter) {
     iter->ht = ht;
     iter->current_index = 0;
-    iter->current_entry = NULL;
+}
 
-    // Advance to the first non-empty entry
+bool hashTable_iteratorNext(hashTable_iterator* iter, const char** key, void** value) {
+    hashTable* ht = iter->ht;
+    
+    // Skip empty slots until an occupied one is found
     while (iter->current_index < ht->capacity) {
-        if (ht->entries[iter->current_index] != NULL) {
-            iter->current_entry = ht->entries[iter->current_index];
-            break;
-        }
-        //empty entry, move to next index
+        ht_entry* entry = slotAt(ht, iter->current_index);
         iter->current_index++;
+
+        if (entry->key != NULL) {
+            // Return the current key-value pair
+            *key = entry->key;
+            *value = entryValue(ht, entry);
+            return true; // Successfully returned a key-value pair
+        }
     }
 
+    return false; // No more entries
 }
 
-bool hashTable_iteratorNext(hashTable_iterator* iter, const char** key, void** value) {
-    // Check if current entry is valid
-    if (iter->current_entry == NULL) {
-        return false; // No more entries
+const ht_entry* hashTable_valueEntry(const hashTable* ht, const void* value) {
+    if (ht->value_size == 0) {
+        return NULL; // The slot holds a pointer to the value, not the value
     }
-    
-    // Return the current key-value pair
-    *key = iter->current_entry->key;
-    *value = iter->current_entry->value;
+    // An inline value follows the entry header of its slot
+    return (const ht_entry*)value - 1;
+}
 
-    // Move to the next entry in the linked list
-    iter->current_entry = iter->current_entry->next;
+size_t hashTable_getLength(hashTable* ht) {
+    return ht->length;
+}
 
-    // If the end of the linked list is reached, move to the next index
-    if (iter->current_entry == NULL) {
-        iter->current_index++;
-        while (iter->current_index < iter->ht->capacity && 
-               iter->ht->entries[iter->current_index] == NULL) {
-            iter->current_index++;
-        }
-        if (iter->current_index < iter->ht->capacity) {
-            iter->current_entry = iter->ht->entries[iter->current_index];
-        }
-        else {
-            //do nothing, keep current_entry as NULL to indicate end
+size_t hashTable_getMemoryUsage(const hashTable* ht) {
+    return ht->capacity * ht->slot_size + arena_getBytesReserved(ht->arena);
+}
+
+void hashTable_getProbeStats(hashTable* ht, double* meanProbeLength, size_t* maxProbeLength) {
+    size_t mask = ht->capacity - 1;
+    size_t totalProbes = 0;
+    size_t longestProbe = 0;
+
+    for (size_t i = 0; i < ht->capacity; i++) {
+        ht_entry* entry = slotAt(ht, i);
+        if (entry->key != NULL) {
+            // Slots inspected from the home slot up to and including this one
+            size_t probeLength = ((i - homeSlot(ht, entry->hash)) & mask) + 1;
+            totalProbes += probeLength;
+            if (probeLength > longestProbe) {
+                longestProbe = probeLength;
+            }
         }
     }
 
-    return true; // Successfully returned a key-value pair
+    if (meanProbeLength != NULL) {
+        *meanProbeLength = (ht->length > 0) ? (double)totalProbes / (double)ht->length : 0.0;
+    }
+    if (maxProbeLength != NULL) {
+        *maxProbeLength = longestProbe;
+    }
 }
 
-size_t hashTable_getLength(hashTable* ht) {
-    return ht->length;
+void hashTable_getStats(hashTable* ht, hashTable_stats* stats) {
+    // Counters as maintained by the table, then its current shape
+    *stats = ht->stats;
+    stats->length = ht->length;
+    stats->capacity = ht->capacity;
+    stats->load_factor = (double)ht->length / (double)ht->capacity;
+    hashTable_getProbeStats(ht, &stats->mean_probe_length, &stats->max_probe_length);
 }
 
 /*========================================================== */
 /*==================== Private Functions =================== */
 /*========================================================== */
-static unsigned long hash_djb2(const char *str) {
-    unsigned long hash = 5381; // Initial hash value, a prime number
-    int c; // To store each character of the string
+static inline size_t hashKey(const hashTable* ht, const char* key, size_t length) {
+    return (size_t)ht->hash_function(key, length, ht->hash_seed);
+}
 
-    // Loop through the string until the null terminator is reached
-    while ((c = *str++)) 
-    {
-        // Core hashing operation: hash * 33 + c
-        hash = ((hash << 5) + hash) + c; 
+static size_t homeSlot(const hashTable* ht, size_t hash) {
+    // 2^64 / golden ratio, spreads the hash over the top bits of the product
+    uint64_t mixed = (uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15);
+    return (size_t)(mixed >> (64u - ht->capacity_bits));
+}
+
+static inline ht_entry* slotAt(const hashTable* ht, size_t index) {
+    return (ht_entry*)(ht->entries + index * ht->slot_size);
+}
+
+static inline void* entryValue(const hashTable* ht, ht_entry* entry) {
+    void* valueBytes = (void*)(entry + 1); // The value follows the entry header
+    if (ht->value_size > 0) {
+        return valueBytes;
     }
+    void* value;
+    memcpy(&value, valueBytes, sizeof(void*));
+    return value;
+}
 
-    return hash;
+static inline void setEntryValue(const hashTable* ht, ht_entry* entry, const void* value) {
+    if (ht->value_size > 0) {
+        memcpy(entry + 1, value, ht->value_size);
+    } else {
+        memcpy(entry + 1, &value, sizeof(void*));
+    }
 }
 
-static void* insertElement (hashTable* ht, const char* key, const void* value, size_t index) {
-    ht_entry* newEntry = (ht_entry*)malloc(sizeof(ht_entry));
-    if (newEntry == NULL) {
-        return NULL; // Memory allocation failed
+static inline bool isInlineKey(const hashTable* ht, size_t length) {
+    return ht->key_offset != 0 && length < HASHTABLE_INLINE_KEY_SIZE;
+}
+
+static inline void moveSlot(const hashTable* ht, void* dst, const void* src) {
+    memcpy(dst, src, ht->slot_size);
+    ht_entry* entry = (ht_entry*)dst;
+    if (isInlineKey(ht, entry->length)) {
+        entry->key = (const char*)dst + ht->key_offset; // The key bytes moved with the slot
+    }
+}
+
+static inline bool inlineKeyEquals(const hashTable* ht, const ht_entry* entry, const uint64_t* probe) {
+    const unsigned char* keyBytes = (const unsigned char*)entry + ht->key_offset;
+    uint64_t difference = 0;
+    for (size_t i = 0; i < HASHTABLE_INLINE_KEY_WORDS; i++) {
+        uint64_t word;
+        memcpy(&word, keyBytes + i * 8, sizeof(word));
+        difference |= word ^ probe[i];
+    }
+    return difference == 0;
+}
+
+static ht_entry* findEntry(hashTable* ht, const char* key, size_t length, size_t hash) {
+    size_t mask = ht->capacity - 1;
+    size_t index = homeSlot(ht, hash);
+    size_t distance = 0; // probe distance of the searched key at index
+
+    // Pad a short key once, it is then compared word by word with the slots
+    bool inlineKey = isInlineKey(ht, length);
+    uint64_t probe[HASHTABLE_INLINE_KEY_WORDS];
+    if (inlineKey) {
+        memset(probe, 0, sizeof(probe));
+        memcpy(probe, key, length);
     }
-    newEntry->key = strdup(key); // Duplicate the key string
-    newEntry->value = (void*)value; // Set the value
 
-    newEntry->next = ht->entries[index]; // Insert at the beginning of the list     
-    ht->entries[index] = newEntry; // Update the head of the list
+    STATS_ADD(ht->stats.lookups, 1);
+    while (true)
+    {
+        ht_entry* entry = slotAt(ht, index);
+        STATS_ADD(ht->stats.probes, 1);
+
+        if (entry->key == NULL) {
+            return NULL; // Empty slot, key not present
+        }
+
+        // A resident closer to home than the key means the key was never placed here
+        size_t residentDistance = (index - homeSlot(ht, entry->hash)) & mask;
+        if (residentDistance < distance) {
+            return NULL;
+        }
+
+        // Compare the stored hash and length first, only compare bytes on a match
+        if (entry->hash == hash && entry->length == length) {
+            STATS_ADD(ht->stats.comparisons, 1);
+            if (inlineKey ? inlineKeyEquals(ht, entry, probe) : memcmp(key, entry->key, length) == 0) {
+                STATS_ADD(ht->stats.hits, 1);
+                return entry;
+            }
+        }
+
+        index = (index + 1) & mask;
+        distance++;
+    }
+}
+
+static void* insertElement (hashTable* ht, const char* key, size_t length, const void* value, size_t hash) {
+    // Grow before inserting so the new entry is placed in the final array
+    if (ht->length + 1 > ht->grow_threshold) {
+        if (!resize(ht)) {
+            return NULL; // Memory allocation failed
+        }
+    }
+
+    // Build the new slot in scratch space, then move it into the table
+    ht_entry* newEntry = (ht_entry*)ht->scratch;
+    char* keyCopy;
+    if (isInlineKey(ht, length)) {
+        // Copy the key into the slot, zero padded as findEntry() compares it
+        keyCopy = (char*)ht->scratch + ht->key_offset;
+        memset(keyCopy, 0, HASHTABLE_INLINE_KEY_SIZE);
+        memcpy(keyCopy, key, length);
+    } else if (ht->arena != NULL) {
+        // Pack the key next to the previously inserted ones
+        keyCopy = arena_strndup(ht->arena, key, length);
+        if (keyCopy == NULL) {
+            return NULL; // Memory allocation failed
+        }
+    } else {
+        keyCopy = (char*)malloc(length + 1);
+        STATS_ALLOCATION(length + 1);
+        if (keyCopy == NULL) {
+            return NULL; // Memory allocation failed
+        }
+        memcpy(keyCopy, key, length); // Copy the key bytes
+        keyCopy[length] = '\0';      // Keep keys null-terminated for the iterator
+    }
+    newEntry->key = keyCopy;
+    newEntry->length = length;
+    newEntry->hash = hash;
+    setEntryValue(ht, newEntry, value); // Set the value
+
+    ht_entry* placed = placeEntry(ht, newEntry);
 
     ht->length++; // Increment the number of items in the hash table
+    STATS_ADD(ht->stats.inserts, 1);
+
+    return entryValue(ht, placed); // Return the inserted value
+}
+
+static ht_entry* placeEntry(hashTable* ht, const ht_entry* entry) {
+    size_t mask = ht->capacity - 1;
+    size_t index = homeSlot(ht, entry->hash);
+    size_t distance = 0; // probe distance of the entry being placed
+    unsigned char* carried = ht->scratch;                 // slot being placed
+    unsigned char* displaced = ht->scratch + ht->slot_size; // slot taken over
+    ht_entry* placed = NULL; // where the original entry ended up
 
-    return newEntry->value; // Return the inserted value
-}
-
-// TODO: update hashtable struct to add size of value (in bytes)
-// TODO: upate hastable configuration struct (and default values) \
-            to add size of value (in bytes)
-// TODO: update create function to init hashtable struct properly 
-//TODO: implement hash table resize
-// TODO: implement rehashing when load factor exceeds max_load_factor
-// TODO: implement hash table delete
-// TODO: implement public getters for length and capacity
-// TODO: revise all public API functions for error handling and edge cases
-// TODO: add other hashing algorithms support (sdbm, FNV-1a, etc.)
-// TODO: restructre to have hash function is a separate module 
-// TODO: define error status codes 
-// TODO: make sure all files have copyright notice
\ No newline at end of file
+    if ((const unsigned char*)entry != carried) {
+        moveSlot(ht, carried, entry);
+    }
+
+    while (true)
+    {
+        ht_entry* slot = slotAt(ht, index);
+
+        if (slot->key == NULL) {
+            moveSlot(ht, slot, carried); // Empty slot found, place the entry
+            return (placed != NULL) ? placed : slot;
+        }
+
+        // Take the slot from a resident that is closer to its home slot
+        size_t residentDistance = (index - homeSlot(ht, slot->hash)) & mask;
+        if (residentDistance < distance) {
+            moveSlot(ht, displaced, slot);
+            moveSlot(ht, slot, carried);
+            unsigned char* swap = carried;
+            carried = displaced;
+            displaced = swap;
+            distance = residentDistance;
+            if (placed == NULL) {
+                placed = slot;
+            }
+        }
+
+        index = (index + 1) & mask;
+        distance++;
+    }
+}
+
+static bool resize(hashTable* ht) {
+    unsigned char* oldEntries = ht->entries;
+    size_t oldCapacity = ht->capacity;
+
+    unsigned char* newEntries = (unsigned char*)calloc(oldCapacity * 2, ht->slot_size);
+    if (newEntries == NULL) {
+        return false; // Memory allocation failed, keep the current array
+    }
+    STATS_ALLOCATION(oldCapacity * 2 * ht->slot_size);
+    STATS_ADD(ht->stats.resizes, 1);
+
+    ht->entries = newEntries;
+    ht->capacity = oldCapacity * 2;
+    ht->capacity_bits++;
+    ht->grow_threshold = growThreshold(ht->capacity, ht->max_load_factor);
+
+    // Re-place every entry using its stored hash
+    for (size_t i = 0; i < oldCapacity; i++) {
+        const ht_entry* entry = (const ht_entry*)(oldEntries + i * ht->slot_size);
+        if (entry->key != NULL) {
+            placeEntry(ht, entry);
+        }
+    }
+
+    free(oldEntries);
+    return true;
+}
+
+static size_t growThreshold(size_t capacity, double maxLoadFactor) {
+    size_t threshold = (size_t)((double)capacity * maxLoadFactor);
+
+    // Always keep at least one empty slot so probing terminates
+    if (threshold >= capacity) {
+        threshold = capacity - 1;
+    }
+    return threshold;
+}
@@ -0,0 +1,388 @@
+/*
+ * Most Frequent Words - Command line entry point
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "mostFrequentWords_cfg.h"
+#include "ngramCounter_cfg.h"
+#include "mostFrequentWords.h"
+#include "snapshot.h"
+#include "stats.h"
+#include "stopwords.h"
+#include "slidingWindow.h"
+
+// true for a non-empty argument made of digits only
+static bool isCount(const char *arg) {
+    if (*arg == '\0') {
+        return false;
+    }
+    for (; *arg != '\0'; arg++) {
+        if (*arg < '0' || *arg > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool isDirectory(const char *path) {
+    struct stat info;
+    return stat(path, &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+// count many files and directories at once, optionally ranking each file too
+static int runBatch(const char *const *paths, size_t pathCount, int32_t n, int32_t perFileN,
+                    const frequentWords_config *config) {
+    frequentWords_batchResult *result = find_frequent_words_batch(paths, pathCount, n, perFileN, config);
+    if (result == NULL) {
+        return 1;
+    }
+    for (size_t f = 0; perFileN > 0 && f < result->file_count; f++) {
+        const frequentWords_fileResult *file = &result->files[f];
+        if (!file->ok) {
+            continue; // already reported while counting
+        }
+        printf("File %s\n", file->path);
+        for (size_t i = 0; i < file->selected; i++) {
+            printf("  Frequent Word %zu: %s (count %llu)\n", i + 1, file->top[i].word,
+                   (unsigned long long)file->top[i].count);
+        }
+    }
+    printf("All %zu files (%zu unreadable)\n", result->file_count, result->failed_count);
+    for (size_t i = 0; i < result->selected; i++) {
+        printf("Frequent Word %zu: %s (count %llu)\n", i + 1, result->top[i].word,
+               (unsigned long long)result->top[i].count);
+    }
+    int status = (result->failed_count > 0) ? 1 : 0;
+    frequentWords_freeBatch(result);
+    return status;
+}
+
+// rank the words of a snapshot straight from the file, without counting anything
+static int runSnapshotQuery(const char *path, int32_t n) {
+    snapshot snap;
+    // ranking reads every count anyway, and a damaged file must not be trusted
+    if (!snapshot_open(path, &snap, true)) {
+        printf("Error reading snapshot %s\n", path);
+        return 1;
+    }
+    size_t count = (n > 0) ? (size_t)n : 0;
+    WordCount *top = (WordCount *)malloc((count + 1) * sizeof(WordCount));
+    if (top == NULL) {
+        snapshot_close(&snap);
+        return 1;
+    }
+    size_t selected = 0;
+    snapshot_top(&snap, count, top, &selected);
+    printf("Snapshot %s: %zu words, %llu occurrences\n", path, snapshot_getLength(&snap),
+           (unsigned long long)snap.header->total_count);
+    for (size_t i = 0; i < selected; i++) {
+        printf("Frequent Word %zu: %s (count %llu)\n", i + 1, top[i].word, (unsigned long long)top[i].count);
+    }
+    free(top);
+    snapshot_close(&snap);
+    return 0;
+}
+
+// merge snapshots into outPath without building a table, then rank the result
+static int runSnapshotMerge(const char *const *paths, size_t pathCount, const char *outPath, int32_t n) {
+    snapshot *inputs = (snapshot *)calloc(pathCount, sizeof(snapshot));
+    size_t opened = 0;
+    bool ok = inputs != NULL;
+    for (; ok && opened < pathCount; opened++) {
+        ok = snapshot_open(paths[opened], &inputs[opened], true);
+        if (!ok) {
+            printf("Error reading snapshot %s\n", paths[opened]);
+            break;
+        }
+    }
+    if (ok && !snapshot_merge(outPath, inputs, pathCount)) {
+        printf("Error writing snapshot %s\n", outPath);
+        ok = false;
+    }
+    for (size_t i = 0; i < opened; i++) {
+        snapshot_close(&inputs[i]);
+    }
+    free(inputs);
+    return ok ? runSnapshotQuery(outPath, n) : 1;
+}
+
+// true when every path is a snapshot file
+static bool allSnapshots(const char *const *paths, size_t pathCount) {
+    for (size_t i = 0; i < pathCount; i++) {
+        if (!snapshot_isSnapshot(paths[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint64_t nowMilliseconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+// count the lines of standard input over the last windowSeconds, printing the
+// ranking whenever the window slides by a bucket and at the end of input
+static int runWindow(uint64_t windowSeconds, int32_t n) {
+    slidingWindow_config windowConfig = { 0, 0, (n > 0) ? (size_t)n : 1 };
+    windowConfig.bucket_count = (windowSeconds >= 60) ? 60 : (size_t)(windowSeconds > 0 ? windowSeconds : 1);
+    windowConfig.bucket_width = (windowSeconds > 0 ? windowSeconds : 1) * 1000 / windowConfig.bucket_count;
+    slidingWindow *window = slidingWindow_create(&windowConfig);
+    size_t count = (n > 0) ? (size_t)n : 0;
+    WordCount *top = (WordCount *)malloc((count + 1) * sizeof(WordCount));
+    if (window == NULL || top == NULL) {
+        printf("Error creating window\n");
+        slidingWindow_destroy(window);
+        free(top);
+        return 1;
+    }
+
+    uint64_t start = nowMilliseconds();
+    uint64_t shownBucket = 0;
+    bool shown = false;     // a ranking was printed, in bucket shownBucket
+    bool pending = false;   // lines were added since the last ranking
+    char *line = NULL;
+    size_t lineCapacity = 0;
+    ssize_t lineLength;
+    bool ok = true;
+    bool more = true;
+    while (ok && more) {
+        lineLength = getline(&line, &lineCapacity, stdin);
+        more = lineLength >= 0;
+        uint64_t now = nowMilliseconds() - start;
+        ok = more ? slidingWindow_addText(window, line, (size_t)lineLength, now)
+                  : slidingWindow_advance(window, now);
+        // one ranking per bucket, and at the end only if it would differ from the last one
+        bool newBucket = now / windowConfig.bucket_width != shownBucket;
+        if (!ok || !(more ? newBucket : (!shown || newBucket || pending))) {
+            pending = pending || more;
+            continue;
+        }
+
+        shownBucket = now / windowConfig.bucket_width;
+        shown = true;
+        pending = false;
+        size_t selected = 0;
+        ok = slidingWindow_top(window, count, top, &selected);
+        printf("Window at %.1f s: %llu words, %zu distinct\n", (double)now / 1000.0,
+               (unsigned long long)slidingWindow_getTotal(window), slidingWindow_getLength(window));
+        for (size_t i = 0; ok && i < selected; i++) {
+            printf("Frequent Word %zu: %s (count %llu)\n", i + 1, top[i].word, (unsigned long long)top[i].count);
+        }
+        fflush(stdout);
+    }
+    if (!ok) {
+        printf("Error counting window\n");
+    }
+    free(line);
+    free(top);
+    slidingWindow_destroy(window);
+    return ok ? 0 : 1;
+}
+
+// count standard input, "-" on the command line
+static int runStdin(int32_t n, const frequentWords_config *config, bool verbose) {
+    size_t selected = 0;
+    streamReader_stats stats;
+    frequentWords_estimate *estimates = find_frequent_words_fd(0, n, config, &selected, &stats);
+    if (estimates == NULL) {
+        return 1;
+    }
+    for (size_t i = 0; i < selected; i++) {
+        if (config->engine == FREQUENT_WORDS_SPACE_SAVING) {
+            printf("Frequent Word %zu: %s (count %llu, error <= %llu)\n", i + 1, estimates[i].word,
+                   (unsigned long long)estimates[i].count, (unsigned long long)estimates[i].error);
+        } else {
+            printf("Frequent Word %zu: %s\n", i + 1, estimates[i].word);
+        }
+    }
+    frequentWords_freeEstimates(estimates, selected);
+
+    // on stderr, so the ranking on stdout stays clean for the next stage
+    if (verbose) {
+        fprintf(stderr, "stdin: %llu bytes in %.3f s (%.1f MB/s), %llu reads, %llu buffers\n",
+                (unsigned long long)stats.bytes, stats.elapsed_s,
+                stats.elapsed_s > 0.0 ? (double)stats.bytes / 1e6 / stats.elapsed_s : 0.0,
+                (unsigned long long)stats.reads, (unsigned long long)stats.buffers);
+        if (stats.inflated > 0) {
+            fprintf(stderr, "stdin: gzip input inflated to %llu bytes (%.1fx)\n", (unsigned long long)stats.inflated,
+                    stats.bytes > 0 ? (double)stats.inflated / (double)stats.bytes : 0.0);
+        }
+        fprintf(stderr, "stdin: reader stalled %llu times (%.3f s, counting was slower), "
+                "counter stalled %llu times (%.3f s, input was slower)\n",
+                (unsigned long long)stats.reader_stalls, stats.reader_wait_s,
+                (unsigned long long)stats.scanner_stalls, stats.scanner_wait_s);
+    }
+    return 0;
+}
+
+// count a single file
+static int runFile(const char *path, int32_t n, const frequentWords_config *config) {
+    if (config->engine == FREQUENT_WORDS_SPACE_SAVING) {
+        // approximate counts come with their error bound
+        size_t selected = 0;
+        frequentWords_estimate *estimates = find_frequent_words_estimates(path, n, config, &selected);
+        if (estimates == NULL) {
+            return 1;
+        }
+        for (size_t i = 0; i < selected; i++) {
+            printf("Frequent Word %zu: %s (count %llu, error <= %llu)\n", i + 1, estimates[i].word,
+                   (unsigned long long)estimates[i].count, (unsigned long long)estimates[i].error);
+        }
+        frequentWords_freeEstimates(estimates, selected);
+        return 0;
+    }
+
+    // one block holds every ranked word, freed at once
+    frequentWords_ranking *ranking = find_frequent_words_ranked(path, n, config);
+    if (ranking == NULL) {
+        return 1;
+    }
+
+    for (size_t i = 0; i < ranking->count; i++) {
+        printf("Frequent Word %zu: %s\n", i + 1, ranking->words[i].word);
+    }
+    frequentWords_freeRanking(ranking);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+
+    // usage: mostFrequentWords [-j threads] [-a budgetKiB [-s]] [-f perFileN] [-o out.snap] [-d out.tsv | -D out.bin]
+    //                          [-x | -X stopwords.txt] [-w seconds] [-g words] [-v] [path... | -] [n]
+    const char *path = "shakespeare.txt";
+    int32_t n = 3;
+    int32_t perFileN = 0;
+    bool verbose = false;
+    uint64_t windowSeconds = 0;
+    frequentWords_config config = { (size_t)MFW_DEFAULT_THREAD_COUNT, FREQUENT_WORDS_EXACT, 0, false, NULL, 0,
+                                    NULL, RANKDUMP_TSV, NULL };
+    const char *stopwordPath = NULL;
+
+    int argi = 1;
+    while (argi < argc && argv[argi][0] == '-' && argv[argi][1] != '\0') {
+        if (argi + 1 < argc && strcmp(argv[argi], "-j") == 0) {
+            config.thread_count = (size_t)strtoul(argv[argi + 1], NULL, 10);
+            argi += 2;
+        } else if (argi + 1 < argc && strcmp(argv[argi], "-a") == 0) {
+            // approximate counting in a fixed memory budget
+            config.engine = FREQUENT_WORDS_SPACE_SAVING;
+            config.memory_budget = (size_t)strtoull(argv[argi + 1], NULL, 10) * 1024;
+            argi += 2;
+        } else if (strcmp(argv[argi], "-s") == 0) {
+            config.use_sketch = true;
+            argi++;
+        } else if (argi + 1 < argc && strcmp(argv[argi], "-f") == 0) {
+            // top words of every file, alongside the global ranking
+            perFileN = (int32_t)atoi(argv[argi + 1]);
+            argi += 2;
+        } else if (argi + 1 < argc && strcmp(argv[argi], "-o") == 0) {
+            // save the exact counts, inputs can be earlier snapshots
+            config.snapshot_path = argv[argi + 1];
+            argi += 2;
+        } else if (argi + 1 < argc && (strcmp(argv[argi], "-d") == 0 || strcmp(argv[argi], "-D") == 0)) {
+            // rank every word into a TSV (-d) or binary (-D) file
+            config.dump_path = argv[argi + 1];
+            config.dump_format = (argv[argi][1] == 'D') ? RANKDUMP_BINARY : RANKDUMP_TSV;
+            argi += 2;
+        } else if (strcmp(argv[argi], "-x") == 0) {
+            // leave out the built-in stopwords
+            config.stopword_filter = &stopwords_builtin;
+            argi++;
+        } else if (argi + 1 < argc && strcmp(argv[argi], "-X") == 0) {
+            // leave out the words of a stopword file
+            stopwordPath = argv[argi + 1];
+            argi += 2;
+        } else if (argi + 1 < argc && strcmp(argv[argi], "-w") == 0) {
+            // most frequent words of the last seconds of standard input
+            windowSeconds = (uint64_t)strtoull(argv[argi + 1], NULL, 10);
+            argi += 2;
+        } else if (argi + 1 < argc && strcmp(argv[argi], "-g") == 0) {
+            // most frequent phrases of this many words
+            config.ngram_size = (size_t)strtoul(argv[argi + 1], NULL, 10);
+            argi += 2;
+        } else if (strcmp(argv[argi], "-v") == 0) {
+            verbose = true;
+            argi++;
+        } else {
+            break;
+        }
+    }
+
+    // a trailing number after the paths is n (name a file "123" as ./123)
+    int pathEnd = argc;
+    if (pathEnd - argi >= 2 && isCount(argv[pathEnd - 1])) {
+        n = (int32_t)atoi(argv[--pathEnd]);
+    }
+    if (argi < pathEnd) {
+        path = argv[argi];
+    }
+
+    const char *const *paths = (const char *const *)&argv[argi];
+    size_t pathCount = (size_t)(pathEnd - argi);
+    bool snapshotsOnly = pathCount > 0 && perFileN == 0 && config.engine == FREQUENT_WORDS_EXACT &&
+                         config.dump_path == NULL && allSnapshots(paths, pathCount);
+    bool batch = pathCount > 1 || perFileN > 0 || (pathCount == 1 && isDirectory(path));
+    if (config.ngram_size > NGRAMCOUNTER_MAX_SIZE) {
+        printf("Error: -g counts phrases of at most %d words\n", NGRAMCOUNTER_MAX_SIZE);
+        return 1;
+    }
+    if (config.ngram_size > 1 && (batch || windowSeconds > 0 || config.engine != FREQUENT_WORDS_EXACT)) {
+        printf("Error: -g counts one file or standard input exactly, without -a, -f or -w\n");
+        return 1;
+    }
+    if (config.dump_path != NULL && (config.ngram_size > 1 || windowSeconds > 0 ||
+                                     config.engine != FREQUENT_WORDS_EXACT)) {
+        printf("Error: -d and -D rank exact word counts, without -a, -g or -w\n");
+        return 1;
+    }
+    if ((config.stopword_filter != NULL || stopwordPath != NULL) && (config.ngram_size > 1 || windowSeconds > 0)) {
+        printf("Error: -x and -X leave out single words, without -g or -w\n");
+        return 1;
+    }
+    stopwords *loaded = NULL;
+    if (stopwordPath != NULL) {
+        loaded = stopwords_load(stopwordPath);
+        if (loaded == NULL) {
+            printf("Error reading stopwords %s (words of at most %d bytes)\n", stopwordPath, STOPWORDS_MAX_LENGTH);
+            return 1;
+        }
+        config.stopword_filter = loaded;
+    }
+
+    int status;
+    if (pathCount == 1 && strcmp(path, "-") == 0 && windowSeconds > 0) {
+        status = runWindow(windowSeconds, n);
+    } else if (pathCount == 1 && strcmp(path, "-") == 0) {
+        // "-" reads standard input, through a pipe or a redirection
+        status = runStdin(n, &config, verbose);
+    } else if (snapshotsOnly && config.snapshot_path != NULL) {
+        // snapshots alone are merged side by side into the -o file
+        status = runSnapshotMerge(paths, pathCount, config.snapshot_path, n);
+    } else if (snapshotsOnly && pathCount == 1) {
+        // a lone snapshot is queried in place
+        status = runSnapshotQuery(path, n);
+    } else if (batch) {
+        // several paths, a directory or per-file rankings make a batch
+        status = runBatch(paths, pathCount, n, perFileN, &config);
+    } else {
+        status = runFile(path, n, &config);
+    }
+
+    // phase timers and table counters of builds made with make stats-build
+    if (verbose) {
+        stats_dump(stderr);
+    }
+    stopwords_destroy(loaded);
+    return status;
+}
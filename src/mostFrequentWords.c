@@ -10,110 +10,964 @@
 #include <ctype.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <pthread.h>
 
-#include "utility.h"
+#include "mostFrequentWords_cfg.h"
 #include "mostFrequentWords.h"
 #include "hashTable.h"
+#include "wordScanner.h"
+#include "fileReader.h"
+#include "topN.h"
+#include "spaceSaving.h"
+#include "ngramCounter.h"
+#include "snapshot.h"
+#include "rankDump.h"
+#include "stats.h"
 
-typedef struct 
-{ 
-    char *word; 
-    int count; 
-} WordCount;
+// Incremental counting session: a table fed by a scanner that carries partial words
+struct frequentWords_session
+{
+    hashTable *freqMap;     // counts of every completed word
+    wordScanner scanner;    // splits fed buffers into words
+};
 
-static int cmpWordCount(const void *a, const void *b);
+// Work of one counting thread: a chunk of the mapped file and its private table
+typedef struct
+{
+    const char *data;       // start of the chunk, aligned on a word boundary
+    size_t length;          // number of bytes in the chunk
+    hashTable *freqMap;     // table owned by the thread
+    const stopwords *filter;// words not counted, NULL for none
+    bool ok;                // false if counting the chunk failed
+} CountTask;
+
+// Files of a batch still to be counted, shared by its workers
+typedef struct
+{
+    char **paths;                       // every file of the batch
+    size_t count;                       // number of files
+    size_t next;                        // index of the next file to hand out
+    pthread_mutex_t lock;               // guards next
+    int32_t perFileN;                   // words ranked per file, 0 for none
+    const stopwords *filter;            // words not counted, NULL for none
+    frequentWords_fileResult *files;    // per-file results, one per path
+} BatchQueue;
+
+// Work of one batch thread: whole files counted into a private table
+typedef struct
+{
+    BatchQueue *queue;      // files to take from
+    hashTable *freqMap;     // counts of every file this worker took
+    bool ok;                // false if memory ran out
+} BatchWorker;
+
+static hashTable *createFreqMap(void);
+static char **rankWords(hashTable *freqMap, int32_t n);
+static frequentWords_ranking *rankTable(hashTable *freqMap, int32_t n);
+static frequentWords_ranking *allocRanking(size_t count);
+static frequentWords_ranking *storeWords(frequentWords_ranking *ranking);
+static bool countWord(const char *word, size_t length, uint64_t hash, void *context);
+static void initCountingScanner(wordScanner *scanner, hashTable *freqMap, const stopwords *filter);
+static const stopwords *stopwordFilter(const frequentWords_config *config);
+static hashTable *countExact(const char *path, const frequentWords_config *config);
+static hashTable *countFile(const char *path, const stopwords *filter);
+static bool addFile(const char *path, hashTable *freqMap, const stopwords *filter);
+static bool saveSnapshot(hashTable *freqMap, const frequentWords_config *config);
+static bool saveDump(hashTable *freqMap, const frequentWords_config *config);
+static hashTable *countFileParallel(const char *path, size_t threadCount, const stopwords *filter);
+static void *countChunk(void *arg);
+static bool mergeCounts(hashTable *dst, hashTable *src);
+static bool summarizeWord(const char *word, size_t length, void *context);
+static spaceSaving *summarizeFile(const char *path, const frequentWords_config *config);
+static bool countsPhrases(const frequentWords_config *config);
+static bool phrasesAllowed(const char *path, const frequentWords_config *config);
+static ngramCounter *countPhrases(const char *path, const frequentWords_config *config);
+static bool selectPhraseEstimates(ngramCounter *counter, size_t n, frequentWords_estimate *estimates, size_t *count);
+static bool selectEstimates(hashTable *freqMap, size_t n, frequentWords_estimate *estimates, size_t *count);
+static frequentWords_estimate *rankEstimates(hashTable *freqMap, int32_t n, size_t *selected);
+static bool selectSummaryEstimates(spaceSaving *summary, size_t n, frequentWords_estimate *estimates, size_t *count);
+static void *countBatch(void *arg);
+static bool countBatchFile(BatchWorker *worker, size_t index);
 
 char **find_frequent_words(const char *path, int32_t n) {
+    return find_frequent_words_ex(path, n, NULL);
+}
+
+char **find_frequent_words_ex(const char *path, int32_t n, const frequentWords_config *config) {
+
+    if (config != NULL && (config->engine == FREQUENT_WORDS_SPACE_SAVING || countsPhrases(config))) {
+        //keep only the words of the estimates
+        size_t selected = 0;
+        frequentWords_estimate *estimates = find_frequent_words_estimates(path, n, config, &selected);
+        if (estimates == NULL) {
+            return NULL;
+        }
+        char** result = (char**)calloc(selected + 1, sizeof(char*));
+        if (result == NULL) {
+            frequentWords_freeEstimates(estimates, selected);
+            return NULL;
+        }
+        for (size_t i = 0; i < selected; i++) {
+            result[i] = estimates[i].word;
+        }
+        free(estimates);
+        return result;
+    }
 
-    //create a file pointer
-    FILE *fptr;
-    char wordBuff[100];
-    fptr = fopen(path, "r");
-    if(fptr == NULL) {
-        printf("Error opening file\n");
+    //count every word of the file into a freq map
+    hashTable* freqMap = countExact(path, config);
+    if (freqMap == NULL) {
+        return NULL;
+    }
+    if (!saveSnapshot(freqMap, config) || !saveDump(freqMap, config)) {
+        hashTable_destroy(freqMap);
         return NULL;
     }
 
-    //create a freq map 
-    hashTable* freqMap = hashTable_create(NULL);
+    char** result = rankWords(freqMap, n);
+
+    //delete freq map
+    hashTable_destroy(freqMap);
+
+    return result;
+}
+
+frequentWords_ranking *find_frequent_words_ranked(const char *path, int32_t n, const frequentWords_config *config) {
+    if (n < 0) {
+        n = 0;
+    }
+
+    if (config != NULL && (config->engine == FREQUENT_WORDS_SPACE_SAVING || countsPhrases(config))) {
+        //pack the estimates into a ranking, without their error bounds
+        size_t selected = 0;
+        frequentWords_estimate *estimates = find_frequent_words_estimates(path, n, config, &selected);
+        if (estimates == NULL) {
+            return NULL;
+        }
+        frequentWords_ranking *ranking = allocRanking(selected);
+        for (size_t i = 0; ranking != NULL && i < selected; i++) {
+            ranking->words[i].word = estimates[i].word;
+            ranking->words[i].count = estimates[i].count;
+        }
+        ranking = storeWords(ranking);
+        frequentWords_freeEstimates(estimates, selected);
+        if (ranking == NULL) {
+            printf("Error ranking words\n");
+        }
+        return ranking;
+    }
+
+    //count every word of the file into a freq map
+    hashTable *freqMap = countExact(path, config);
     if (freqMap == NULL) {
+        return NULL;
+    }
+    frequentWords_ranking *ranking = NULL;
+    if (saveSnapshot(freqMap, config) && saveDump(freqMap, config)) {
+        ranking = rankTable(freqMap, n);
+    }
+    hashTable_destroy(freqMap);
+    return ranking;
+}
+
+void frequentWords_freeRanking(frequentWords_ranking *ranking) {
+    //the words live in the same block as the records
+    free(ranking);
+}
+
+frequentWords_estimate *find_frequent_words_estimates(const char *path, int32_t n,
+                                                      const frequentWords_config *config,
+                                                      size_t *selected) {
+    *selected = 0;
+    if (n < 0) {
+        n = 0;
+    }
+
+    //one extra slot so an empty selection still returns a valid array
+    frequentWords_estimate *estimates =
+        (frequentWords_estimate *)calloc((size_t)n + 1, sizeof(frequentWords_estimate));
+    if (estimates == NULL) {
+        printf("Error ranking words\n");
+        return NULL;
+    }
+
+    size_t count = 0;
+    bool ok;
+    if (config != NULL && config->engine == FREQUENT_WORDS_SPACE_SAVING) {
+        spaceSaving *summary = summarizeFile(path, config);
+        if (summary == NULL) {
+            free(estimates);
+            return NULL;
+        }
+        ok = selectSummaryEstimates(summary, (size_t)n, estimates, &count);
+        spaceSaving_destroy(summary);
+    } else if (countsPhrases(config)) {
+        ngramCounter *counter = countPhrases(path, config);
+        if (counter == NULL) {
+            free(estimates);
+            return NULL;
+        }
+        ok = selectPhraseEstimates(counter, (size_t)n, estimates, &count);
+        ngramCounter_destroy(counter);
+    } else {
+        hashTable *freqMap = countExact(path, config);
+        if (freqMap == NULL) {
+            free(estimates);
+            return NULL;
+        }
+        ok = saveSnapshot(freqMap, config) && saveDump(freqMap, config) &&
+             selectEstimates(freqMap, (size_t)n, estimates, &count);
+        hashTable_destroy(freqMap);
+    }
+
+    if (!ok) {
+        printf("Error ranking words\n");
+        frequentWords_freeEstimates(estimates, count);
+        return NULL;
+    }
+    *selected = count;
+    return estimates;
+}
+
+frequentWords_estimate *find_frequent_words_fd(int fd, int32_t n, const frequentWords_config *config,
+                                               size_t *selected, streamReader_stats *stats) {
+    *selected = 0;
+    if (n < 0) {
+        n = 0;
+    }
+
+    //one extra slot so an empty selection still returns a valid array
+    frequentWords_estimate *estimates =
+        (frequentWords_estimate *)calloc((size_t)n + 1, sizeof(frequentWords_estimate));
+    if (estimates == NULL) {
+        printf("Error ranking words\n");
+        return NULL;
+    }
+
+    //count into a summary, an n-gram counter or a freq map, all fed by the same pipelined reader
+    bool approximate = config != NULL && config->engine == FREQUENT_WORDS_SPACE_SAVING;
+    bool phrases = !approximate && countsPhrases(config);
+    if (phrases && !phrasesAllowed(NULL, config)) {
+        free(estimates);
+        return NULL;
+    }
+    spaceSaving_config summaryConfig = { approximate ? config->memory_budget : 0, approximate && config->use_sketch };
+    spaceSaving *summary = approximate ? spaceSaving_create(&summaryConfig) : NULL;
+    ngramCounter *counter = phrases ? ngramCounter_create(config->ngram_size) : NULL;
+    hashTable *freqMap = (approximate || phrases) ? NULL : createFreqMap();
+    if (summary == NULL && counter == NULL && freqMap == NULL) {
         printf("Error creating hash table\n");
-        fclose(fptr);
+        free(estimates);
+        return NULL;
+    }
+
+    wordScanner scanner;
+    if (approximate) {
+        wordScanner_init(&scanner, summarizeWord, summary);
+        wordScanner_setFilter(&scanner, stopwordFilter(config));
+    } else if (phrases) {
+        wordScanner_init(&scanner, ngramCounter_addWord, counter);
+    } else {
+        initCountingScanner(&scanner, freqMap, stopwordFilter(config));
+    }
+    double start = STATS_START();
+    bool ok = streamReader_scanFd(fd, &scanner, stats);
+    STATS_STOP(STATS_PHASE_SCAN, start);
+    wordScanner_destroy(&scanner);
+
+    size_t count = 0;
+    if (!ok) {
+        printf("Error reading input\n");
+    } else if (approximate) {
+        ok = selectSummaryEstimates(summary, (size_t)n, estimates, &count);
+    } else if (phrases) {
+        ok = selectPhraseEstimates(counter, (size_t)n, estimates, &count);
+    } else {
+        ok = saveSnapshot(freqMap, config) && saveDump(freqMap, config) &&
+             selectEstimates(freqMap, (size_t)n, estimates, &count);
+    }
+    spaceSaving_destroy(summary);
+    ngramCounter_destroy(counter);
+    hashTable_destroy(freqMap);
+
+    if (!ok) {
+        frequentWords_freeEstimates(estimates, count);
         return NULL;
     }
+    *selected = count;
+    return estimates;
+}
+
+void frequentWords_freeEstimates(frequentWords_estimate *estimates, size_t count) {
+    if (estimates == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        free(estimates[i].word);
+    }
+    free(estimates);
+}
+
+frequentWords_batchResult *find_frequent_words_batch(const char *const *paths, size_t pathCount,
+                                                     int32_t n, int32_t perFileN,
+                                                     const frequentWords_config *config) {
+    //expand directories into the files to count
+    fileReader_fileList list;
+    if (!fileReader_listFiles(paths, pathCount, &list)) {
+        printf("Error listing files\n");
+        return NULL;
+    }
+
+    frequentWords_batchResult *result = (frequentWords_batchResult *)calloc(1, sizeof(frequentWords_batchResult));
+    size_t workerCount = (config != NULL) ? config->thread_count : (size_t)MFW_DEFAULT_THREAD_COUNT;
+    if (workerCount > list.count) {
+        workerCount = list.count;
+    }
+    if (workerCount == 0) {
+        workerCount = 1;
+    }
+    BatchWorker *workers = (BatchWorker *)calloc(workerCount, sizeof(BatchWorker));
+    pthread_t *threads = (pthread_t *)calloc(workerCount, sizeof(pthread_t));
+    bool *started = (bool *)calloc(workerCount, sizeof(bool));
+    if (result != NULL) {
+        result->files = (frequentWords_fileResult *)calloc(list.count + 1, sizeof(frequentWords_fileResult));
+    }
+    if (result == NULL || result->files == NULL || workers == NULL || threads == NULL || started == NULL) {
+        printf("Error allocating batch\n");
+        fileReader_freeFileList(&list);
+        frequentWords_freeBatch(result);
+        free(workers);
+        free(threads);
+        free(started);
+        return NULL;
+    }
+
+    //the result owns the paths from now on
+    for (size_t i = 0; i < list.count; i++) {
+        result->files[i].path = list.paths[i];
+    }
+    result->file_count = list.count;
+    BatchQueue queue = { list.paths, list.count, 0, PTHREAD_MUTEX_INITIALIZER, perFileN, stopwordFilter(config),
+                         result->files };
+
+    //worker 0 runs on this thread, the others on their own threads
+    for (size_t w = 0; w < workerCount; w++) {
+        workers[w].queue = &queue;
+        workers[w].freqMap = createFreqMap();
+        workers[w].ok = workers[w].freqMap != NULL;
+    }
+    double start = STATS_START();
+    for (size_t w = 1; w < workerCount; w++) {
+        started[w] = (pthread_create(&threads[w], NULL, countBatch, &workers[w]) == 0);
+    }
+    countBatch(&workers[0]);
+
+    bool ok = true;
+    size_t largest = 0;
+    for (size_t w = 0; w < workerCount; w++) {
+        if (started[w]) {
+            pthread_join(threads[w], NULL);
+        }
+        ok = ok && workers[w].ok;
+        if (workers[w].freqMap != NULL &&
+            (workers[largest].freqMap == NULL ||
+             hashTable_getLength(workers[w].freqMap) > hashTable_getLength(workers[largest].freqMap))) {
+            largest = w;
+        }
+    }
+    pthread_mutex_destroy(&queue.lock);
+    STATS_STOP(STATS_PHASE_SCAN, start);
+
+    //merge every worker table into the largest one, then rank once
+    start = STATS_START();
+    hashTable *freqMap = workers[largest].freqMap;
+    for (size_t w = 0; w < workerCount; w++) {
+        if (w != largest) {
+            ok = ok && mergeCounts(freqMap, workers[w].freqMap);
+            hashTable_destroy(workers[w].freqMap);
+        }
+    }
+    STATS_STOP(STATS_PHASE_MERGE, start);
+    ok = ok && saveSnapshot(freqMap, config) && saveDump(freqMap, config);
+    if (ok) {
+        result->top = rankEstimates(freqMap, n, &result->selected);
+        ok = result->top != NULL;
+    }
+    hashTable_destroy(freqMap);
+    free(workers);
+    free(threads);
+    free(started);
+    free(list.paths);
+
+    if (!ok) {
+        printf("Error counting words\n");
+        frequentWords_freeBatch(result);
+        return NULL;
+    }
+    for (size_t i = 0; i < result->file_count; i++) {
+        result->failed_count += !result->files[i].ok;
+    }
+    return result;
+}
+
+void frequentWords_freeBatch(frequentWords_batchResult *result) {
+    if (result == NULL) {
+        return;
+    }
+    frequentWords_freeEstimates(result->top, result->selected);
+    if (result->files != NULL) {
+        for (size_t i = 0; i < result->file_count; i++) {
+            free(result->files[i].path);
+            frequentWords_freeEstimates(result->files[i].top, result->files[i].selected);
+        }
+    }
+    free(result->files);
+    free(result);
+}
+
+frequentWords_session *frequentWords_createSession(void) {
+    frequentWords_session *session = (frequentWords_session *)malloc(sizeof(frequentWords_session));
+    if (session == NULL) {
+        return NULL;
+    }
+    session->freqMap = createFreqMap();
+    if (session->freqMap == NULL) {
+        free(session);
+        return NULL;
+    }
+    initCountingScanner(&session->scanner, session->freqMap, NULL);
+    return session;
+}
+
+bool frequentWords_feed(frequentWords_session *session, const char *data, size_t length) {
+    return wordScanner_feed(&session->scanner, data, length);
+}
+
+bool frequentWords_finish(frequentWords_session *session) {
+    return wordScanner_finish(&session->scanner);
+}
 
-    while(fscanf(fptr, "%99s", wordBuff)==1){
-        //printf("%s,", wordBuff);
-        clean_and_lowercase(wordBuff);
-        hashTable_incrementOrInsert(freqMap, wordBuff);
-        //printf("%s\n", wordBuff);
+char **frequentWords_top(frequentWords_session *session, int32_t n) {
+    //the copies returned by rankWords stay valid while feeding goes on
+    return rankWords(session->freqMap, n);
+}
+
+void frequentWords_destroySession(frequentWords_session *session) {
+    if (session == NULL) {
+        return;
     }
+    wordScanner_destroy(&session->scanner);
+    hashTable_destroy(session->freqMap);
+    free(session);
+}
+
+static bool countWord(const char *word, size_t length, uint64_t hash, void *context) {
+    hashTable *freqMap = (hashTable *)context;
+    return hashTable_incrementOrInsertHashed(freqMap, word, length, (size_t)hash) != NULL;
+}
+
+static void initCountingScanner(wordScanner *scanner, hashTable *freqMap, const stopwords *filter) {
+    //the scanner hashes each word with the table's function, the table does not hash it again
+    wordScanner_initHashed(scanner, countWord, freqMap->hash_function, freqMap->hash_seed, freqMap);
+    //stopwords are dropped by the scanner, before hashing
+    wordScanner_setFilter(scanner, filter);
+}
 
-    fclose(fptr);
+static const stopwords *stopwordFilter(const frequentWords_config *config) {
+    return (config != NULL) ? config->stopword_filter : NULL;
+}
 
+static hashTable *createFreqMap(void) {
+    //zero capacity and load factor keep the table defaults, counters and short words live in the slots
+    hashTable_config config = {0, 0.0, MFW_USE_ARENA, MFW_ARENA_BLOCK_SIZE, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false,
+                               MFW_INLINE_KEYS};
+    return hashTable_create(&config);
+}
+
+static char **rankWords(hashTable *freqMap, int32_t n) {
+    if (n < 0) {
+        n = 0;
+    }
+
+    //select the n best ranked words, they still point into the freq map
+    char** result = (char**)calloc((size_t)n + 1, sizeof(char*));
+    WordCount *topWords = (WordCount *)malloc(((size_t)n + 1) * sizeof(WordCount));
+    size_t selected = 0;
+    double start = STATS_START();
+    bool ranked = result != NULL && topWords != NULL &&
+                  topN_select(freqMap, (size_t)n, topWords, &selected);
+    STATS_STOP(STATS_PHASE_SELECT, start);
+    if (!ranked) {
+        printf("Error ranking words\n");
+        free(result);
+        free(topWords);
+        return NULL;
+    }
+
+    //copy the words out so the result outlives the freq map
+    start = STATS_START();
+    for (size_t i = 0; i < selected; i++) {
+        result[i] = strdup(topWords[i].word);
+        STATS_ALLOCATION(strlen(topWords[i].word) + 1);
+        //printf("Top %zu: %s (Count: %llu)\n", i + 1, result[i], (unsigned long long)topWords[i].count);
+    }
+    STATS_STOP(STATS_PHASE_COPY, start);
+    free(topWords);
+    return result;
+}
+
+//select the n best words as references into the freq map, then copy them once into the ranking block
+static frequentWords_ranking *rankTable(hashTable *freqMap, int32_t n) {
+    //no record for words the table does not have
     size_t length = hashTable_getLength(freqMap);
-    WordCount *wordCountArray = (WordCount *)malloc(length * sizeof(WordCount));
+    size_t wanted = ((size_t)n < length) ? (size_t)n : length;
+    frequentWords_ranking *ranking = allocRanking(wanted);
+    size_t selected = 0;
+    double start = STATS_START();
+    bool ranked = ranking != NULL && topN_select(freqMap, wanted, ranking->words, &selected);
+    STATS_STOP(STATS_PHASE_SELECT, start);
+    if (!ranked) {
+        printf("Error ranking words\n");
+        free(ranking);
+        return NULL;
+    }
+    ranking->count = selected;
+
+    start = STATS_START();
+    ranking = storeWords(ranking);
+    STATS_STOP(STATS_PHASE_COPY, start);
+    if (ranking == NULL) {
+        printf("Error ranking words\n");
+    }
+    return ranking;
+}
+
+static frequentWords_ranking *allocRanking(size_t count) {
+    frequentWords_ranking *ranking =
+        (frequentWords_ranking *)malloc(sizeof(frequentWords_ranking) + count * sizeof(WordCount));
+    if (ranking != NULL) {
+        ranking->count = count;
+    }
+    return ranking;
+}
+
+//grow the block by the bytes of its words and copy them in behind the records, freed on failure
+static frequentWords_ranking *storeWords(frequentWords_ranking *ranking) {
+    if (ranking == NULL) {
+        return NULL;
+    }
+    size_t records = sizeof(frequentWords_ranking) + ranking->count * sizeof(WordCount);
+    size_t bytes = 0;
+    for (size_t i = 0; i < ranking->count; i++) {
+        bytes += strlen(ranking->words[i].word) + 1;
+    }
+
+    //the records move, the words they point at stay where they are until copied
+    frequentWords_ranking *grown = (frequentWords_ranking *)realloc(ranking, records + bytes);
+    if (grown == NULL) {
+        free(ranking);
+        return NULL;
+    }
+    STATS_ALLOCATION(records + bytes);
+    char *next = (char *)grown + records;
+    for (size_t i = 0; i < grown->count; i++) {
+        size_t size = strlen(grown->words[i].word) + 1;
+        memcpy(next, grown->words[i].word, size);
+        grown->words[i].word = next;
+        next += size;
+    }
+    return grown;
+}
+
+static hashTable *countExact(const char *path, const frequentWords_config *config) {
+    size_t threadCount = (config != NULL) ? config->thread_count : (size_t)MFW_DEFAULT_THREAD_COUNT;
+    //snapshots are read whole, there is no text to split between threads
+    bool split = threadCount > 1 && !snapshot_isSnapshot(path);
+    return split ? countFileParallel(path, threadCount, stopwordFilter(config))
+                 : countFile(path, stopwordFilter(config));
+}
+
+static hashTable *countFile(const char *path, const stopwords *filter) {
+    //create a freq map 
+    hashTable* freqMap = createFreqMap();
+    if (freqMap == NULL) {
+        printf("Error creating hash table\n");
+        return NULL;
+    }
+
+    //scan the file in place, counting every cleaned word
+    double start = STATS_START();
+    bool added = addFile(path, freqMap, filter);
+    STATS_STOP(STATS_PHASE_SCAN, start);
+    if (!added) {
+        printf("Error reading file\n");
+        hashTable_destroy(freqMap);
+        return NULL;
+    }
+    return freqMap;
+}
+
+//add the counts of a snapshot, or of every word scanned from any other file
+static bool addFile(const char *path, hashTable *freqMap, const stopwords *filter) {
+    if (snapshot_isSnapshot(path)) {
+        snapshot snap;
+        if (!snapshot_open(path, &snap, true)) {
+            return false;
+        }
+        bool added = snapshot_addToTable(&snap, freqMap);
+        snapshot_close(&snap);
+        return added;
+    }
+
+    wordScanner scanner;
+    initCountingScanner(&scanner, freqMap, filter);
+    bool scanned = fileReader_scanFile(path, &scanner);
+    wordScanner_destroy(&scanner);
+    return scanned;
+}
+
+//write the counts to the snapshot file of the config, if it names one
+static bool saveSnapshot(hashTable *freqMap, const frequentWords_config *config) {
+    if (config == NULL || config->snapshot_path == NULL) {
+        return true;
+    }
+    double start = STATS_START();
+    bool written = snapshot_writeTable(config->snapshot_path, freqMap);
+    STATS_STOP(STATS_PHASE_SNAPSHOT, start);
+    if (!written) {
+        printf("Error writing snapshot %s\n", config->snapshot_path);
+    }
+    return written;
+}
+
+//write the ranking of every word to the dump file of the config, if it names one
+static bool saveDump(hashTable *freqMap, const frequentWords_config *config) {
+    if (config == NULL || config->dump_path == NULL) {
+        return true;
+    }
+    double start = STATS_START();
+    bool written = rankDump_writeTable(config->dump_path, freqMap, config->dump_format);
+    STATS_STOP(STATS_PHASE_DUMP, start);
+    if (!written) {
+        printf("Error writing dump %s\n", config->dump_path);
+    }
+    return written;
+}
 
-    hashTable_iterator freqMapItr;
-    hashTable_initIterator(freqMap, &freqMapItr);
+static hashTable *countFileParallel(const char *path, size_t threadCount, const stopwords *filter) {
+    fileReader_mapping mapping;
+    if (!fileReader_map(path, &mapping)) {
+        //pipes and other unmappable inputs cannot be split, count them serially
+        return countFile(path, filter);
+    }
+    if (streamReader_isCompressed(mapping.data, mapping.length)) {
+        //a gzip stream can only be inflated from its start, the reader thread overlaps it with counting
+        fileReader_unmap(&mapping);
+        return countFile(path, filter);
+    }
+
+    //do not start threads for chunks too small to pay for them
+    size_t maxThreads = mapping.length / MFW_MIN_CHUNK_SIZE + 1;
+    if (threadCount > maxThreads) {
+        threadCount = maxThreads;
+    }
+
+    CountTask *tasks = (CountTask *)calloc(threadCount, sizeof(CountTask));
+    pthread_t *threads = (pthread_t *)calloc(threadCount, sizeof(pthread_t));
+    bool *started = (bool *)calloc(threadCount, sizeof(bool));
+    if (tasks == NULL || threads == NULL || started == NULL) {
+        printf("Error allocating counting threads\n");
+        free(tasks);
+        free(threads);
+        free(started);
+        fileReader_unmap(&mapping);
+        return NULL;
+    }
+
+    //split the file into chunks whose ends fall on whitespace
+    size_t chunkStart = 0;
+    for (size_t t = 0; t < threadCount; t++) {
+        size_t chunkEnd = mapping.length;
+        if (t + 1 < threadCount) {
+            size_t nominalEnd = mapping.length / threadCount * (t + 1);
+            chunkEnd = wordScanner_nextBoundary(mapping.data, mapping.length,
+                                                nominalEnd > chunkStart ? nominalEnd : chunkStart);
+        }
+        tasks[t].data = mapping.data + chunkStart;
+        tasks[t].length = chunkEnd - chunkStart;
+        tasks[t].filter = filter;
+        chunkStart = chunkEnd;
+    }
+
+    //count chunk 0 on this thread, the others on worker threads
+    double start = STATS_START();
+    for (size_t t = 1; t < threadCount; t++) {
+        started[t] = (pthread_create(&threads[t], NULL, countChunk, &tasks[t]) == 0);
+        if (!started[t]) {
+            countChunk(&tasks[t]); //could not start a thread, count inline
+        }
+    }
+    countChunk(&tasks[0]);
+
+    bool ok = true;
+    size_t largest = 0;
+    for (size_t t = 0; t < threadCount; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+        ok = ok && tasks[t].ok;
+        if (tasks[t].freqMap != NULL &&
+            (tasks[largest].freqMap == NULL ||
+             hashTable_getLength(tasks[t].freqMap) > hashTable_getLength(tasks[largest].freqMap))) {
+            largest = t;
+        }
+    }
+    fileReader_unmap(&mapping);
+    STATS_STOP(STATS_PHASE_SCAN, start);
+
+    //merge every private table into the largest one
+    start = STATS_START();
+    hashTable *freqMap = tasks[largest].freqMap;
+    for (size_t t = 0; t < threadCount; t++) {
+        if (t != largest) {
+            ok = ok && mergeCounts(freqMap, tasks[t].freqMap);
+            hashTable_destroy(tasks[t].freqMap);
+        }
+    }
+    STATS_STOP(STATS_PHASE_MERGE, start);
+    if (!ok) {
+        printf("Error counting words\n");
+        hashTable_destroy(freqMap);
+        freqMap = NULL;
+    }
+
+    free(tasks);
+    free(threads);
+    free(started);
+    return freqMap;
+}
+
+static void *countChunk(void *arg) {
+    CountTask *task = (CountTask *)arg;
+
+    task->freqMap = createFreqMap();
+    if (task->freqMap == NULL) {
+        task->ok = false;
+        return NULL;
+    }
+
+    wordScanner scanner;
+    initCountingScanner(&scanner, task->freqMap, task->filter);
+    task->ok = wordScanner_feed(&scanner, task->data, task->length) &&
+               wordScanner_finish(&scanner);
+    wordScanner_destroy(&scanner);
+    return NULL;
+}
+
+static bool mergeCounts(hashTable *dst, hashTable *src) {
+    hashTable_iterator srcItr;
+    hashTable_initIterator(src, &srcItr);
 
     const char* key;
     void* value;
-    size_t i = 0;
-    while (hashTable_iteratorNext(&freqMapItr, &key, &value)) {
-        int count = *(int*)value;
-        printf("Word: %s, Count: %d\n", key, count);
-        //populate word count array
-        wordCountArray[i].word = strdup(key);
-        wordCountArray[i].count = count;
-        i++;
+    while (hashTable_iteratorNext(&srcItr, &key, &value)) {
+        //words only seen by src start from src's count, the entry knows the key length
+        size_t length = hashTable_valueEntry(src, value)->length;
+        if (hashTable_addCountLen(dst, key, length, *(const uint64_t *)value) == NULL) {
+            return false;
+        }
     }
+    return true;
+}
 
-    qsort(wordCountArray, length, sizeof(WordCount), cmpWordCount);
+static void *countBatch(void *arg) {
+    BatchWorker *worker = (BatchWorker *)arg;
+    BatchQueue *queue = worker->queue;
 
-    char** result = (char**)malloc(n * sizeof(char*));
-    for (int32_t i = 0; i < n && i < (int32_t)length; i++) {
-        result[i] = strdup(wordCountArray[i].word);
-        //printf("Top %d: %s (Count: %d)\n", i + 1, result[i], wordCountArray[i].count);
+    //a worker whose table could not be created leaves the files to the others
+    while (worker->ok) {
+        pthread_mutex_lock(&queue->lock);
+        size_t index = queue->next;
+        if (index < queue->count) {
+            queue->next++;
+        }
+        pthread_mutex_unlock(&queue->lock);
+        if (index >= queue->count) {
+            break;
+        }
+        worker->ok = countBatchFile(worker, index);
     }
-    //free word count array
-    for (size_t j = 0; j < length; j++) {
-        free(wordCountArray[j].word);
+    return NULL;
+}
+
+static bool countBatchFile(BatchWorker *worker, size_t index) {
+    BatchQueue *queue = worker->queue;
+    frequentWords_fileResult *file = &queue->files[index];
+
+    if (queue->perFileN <= 0) {
+        //count straight into the worker table
+        file->ok = addFile(queue->paths[index], worker->freqMap, queue->filter);
+        if (!file->ok) {
+            printf("Error reading file %s\n", queue->paths[index]);
+        }
+        return true;
     }
-    free(wordCountArray);
 
-    //TODO: profile current execution time and memory 
-    //TODO: create min heap 
+    //the file needs its own ranking, so it gets its own table first
+    hashTable *fileMap = createFreqMap();
+    if (fileMap == NULL) {
+        return false;
+    }
+    file->ok = addFile(queue->paths[index], fileMap, queue->filter);
+    if (!file->ok) {
+        printf("Error reading file %s\n", queue->paths[index]);
+        hashTable_destroy(fileMap);
+        return true;
+    }
 
-    //delete freq map
-    hashTable_destroy(freqMap);
+    file->top = rankEstimates(fileMap, queue->perFileN, &file->selected);
+    bool ok = file->top != NULL;
+    if (ok && hashTable_getLength(worker->freqMap) == 0) {
+        //nothing to merge into yet, adopt the file table
+        hashTable_destroy(worker->freqMap);
+        worker->freqMap = fileMap;
+        return true;
+    }
+    ok = ok && mergeCounts(worker->freqMap, fileMap);
+    hashTable_destroy(fileMap);
+    return ok;
+}
 
-    return result;
+static bool selectEstimates(hashTable *freqMap, size_t n, frequentWords_estimate *estimates, size_t *count) {
+    *count = 0;
+    WordCount *topWords = (WordCount *)malloc((n + 1) * sizeof(WordCount));
+    double start = STATS_START();
+    bool ok = topWords != NULL && topN_select(freqMap, n, topWords, count);
+    STATS_STOP(STATS_PHASE_SELECT, start);
+    start = STATS_START();
+    for (size_t i = 0; ok && i < *count; i++) {
+        estimates[i].word = strdup(topWords[i].word);
+        STATS_ALLOCATION(strlen(topWords[i].word) + 1);
+        estimates[i].count = topWords[i].count;
+        estimates[i].error = 0; //exact counts
+        ok = estimates[i].word != NULL;
+    }
+    STATS_STOP(STATS_PHASE_COPY, start);
+    free(topWords);
+    return ok;
 }
 
+static bool selectSummaryEstimates(spaceSaving *summary, size_t n, frequentWords_estimate *estimates, size_t *count) {
+    *count = 0;
+    spaceSaving_estimate *top = (spaceSaving_estimate *)malloc((n + 1) * sizeof(spaceSaving_estimate));
+    bool ok = top != NULL && spaceSaving_top(summary, n, top, count);
+    for (size_t i = 0; ok && i < *count; i++) {
+        estimates[i].word = strdup(top[i].word);
+        estimates[i].count = top[i].count;
+        estimates[i].error = top[i].error;
+        ok = estimates[i].word != NULL;
+    }
+    free(top);
+    return ok;
+}
+
+static frequentWords_estimate *rankEstimates(hashTable *freqMap, int32_t n, size_t *selected) {
+    *selected = 0;
+    if (n < 0) {
+        n = 0;
+    }
+
+    //one extra slot so an empty selection still returns a valid array
+    frequentWords_estimate *estimates =
+        (frequentWords_estimate *)calloc((size_t)n + 1, sizeof(frequentWords_estimate));
+    size_t count = 0;
+    if (estimates == NULL || !selectEstimates(freqMap, (size_t)n, estimates, &count)) {
+        frequentWords_freeEstimates(estimates, count);
+        return NULL;
+    }
+    *selected = count;
+    return estimates;
+}
 
-int main() {
+static bool summarizeWord(const char *word, size_t length, void *context) {
+    return spaceSaving_add((spaceSaving *)context, word, length);
+}
 
-    // find_frequent_words("test_simple.txt", 3);
-    // find_frequent_words("test_punctuation.txt", 3);
-    // find_frequent_words("test_ties.txt", 3);
-    // find_frequent_words("test_large.txt", 3);
-    char** freqWords = find_frequent_words("shakespeare.txt", 3);
+static spaceSaving *summarizeFile(const char *path, const frequentWords_config *config) {
+    spaceSaving_config summaryConfig = { config->memory_budget, config->use_sketch };
+    spaceSaving *summary = spaceSaving_create(&summaryConfig);
+    if (summary == NULL) {
+        printf("Error creating summary\n");
+        return NULL;
+    }
 
-    for (int i = 0; i < 3; i++) {
-        printf("Frequent Word %d: %s\n", i + 1, freqWords[i]);
+    //the summary has a fixed size, so it is fed serially from one scanner
+    wordScanner scanner;
+    wordScanner_init(&scanner, summarizeWord, summary);
+    wordScanner_setFilter(&scanner, config->stopword_filter);
+    double start = STATS_START();
+    bool scanned = fileReader_scanFile(path, &scanner);
+    STATS_STOP(STATS_PHASE_SCAN, start);
+    wordScanner_destroy(&scanner);
+    if (!scanned) {
+        printf("Error reading file\n");
+        spaceSaving_destroy(summary);
+        return NULL;
     }
-    return 0;
+    return summary;
 }
 
-static int cmpWordCount(const void *a, const void *b) {
-    WordCount *wcA = (WordCount *)a;
-    WordCount *wcB = (WordCount *)b;
+//phrases of several words are counted by an n-gram counter instead of the freq map
+static bool countsPhrases(const frequentWords_config *config) {
+    return config != NULL && config->engine == FREQUENT_WORDS_EXACT && config->ngram_size > 1;
+}
+
+//snapshots hold single words, there is nothing to read phrases from or save them to
+static bool phrasesAllowed(const char *path, const frequentWords_config *config) {
+    if (config->snapshot_path != NULL || (path != NULL && snapshot_isSnapshot(path))) {
+        printf("Error: snapshots hold single words, not n-grams\n");
+        return false;
+    }
+    return true;
+}
+
+static ngramCounter *countPhrases(const char *path, const frequentWords_config *config) {
+    if (!phrasesAllowed(path, config)) {
+        return NULL;
+    }
+    ngramCounter *counter = ngramCounter_create(config->ngram_size);
+    if (counter == NULL) {
+        printf("Error creating n-gram counter\n");
+        return NULL;
+    }
+
+    //the rolling window runs through the whole file, so it is scanned serially
+    wordScanner scanner;
+    wordScanner_init(&scanner, ngramCounter_addWord, counter);
+    double start = STATS_START();
+    bool scanned = fileReader_scanFile(path, &scanner);
+    STATS_STOP(STATS_PHASE_SCAN, start);
+    wordScanner_destroy(&scanner);
+    if (!scanned) {
+        printf("Error reading file\n");
+        ngramCounter_destroy(counter);
+        return NULL;
+    }
+    return counter;
+}
 
-    // Sort primarily by count in descending order
-    if (wcA->count != wcB->count) {
-        return wcB->count - wcA->count; // Descending order
+static bool selectPhraseEstimates(ngramCounter *counter, size_t n, frequentWords_estimate *estimates, size_t *count) {
+    *count = 0;
+    WordCount *top = (WordCount *)malloc((n + 1) * sizeof(WordCount));
+    double start = STATS_START();
+    bool ok = top != NULL && ngramCounter_top(counter, n, top, count);
+    STATS_STOP(STATS_PHASE_SELECT, start);
+    for (size_t i = 0; ok && i < *count; i++) {
+        estimates[i].word = strdup(top[i].word);
+        estimates[i].count = top[i].count;
+        estimates[i].error = 0; //exact counts
+        ok = estimates[i].word != NULL;
     }
-    // If counts are equal, sort alphabetically in ascending order
-    return strcmp(wcA->word, wcB->word);
+    free(top);
+    return ok;
 }
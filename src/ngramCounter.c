@@ -0,0 +1,455 @@
+/*
+ * Most Frequent Words - N-gram counts
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ngramCounter_cfg.h"
+#include "ngramCounter.h"
+#include "hashFunctions.h"
+#include "hashTable.h"
+#include "stats.h"
+
+// Multiplier of the rolling hash, odd and unrelated to the slot mixing constant
+#define NGRAM_HASH_BASE UINT64_C(0xC2B2AE3D27D4EB4F)
+
+// Largest slot array, so that the slot bits fit in a tag
+#define NGRAM_MAX_CAPACITY_BITS (32u)
+
+// An n-gram of the table: 8 bytes, the rest of it lives in its record
+typedef struct {
+    uint32_t tag;               // top 32 bits of the mixed hash, the slot bits first
+    uint32_t gram;              // index of its record + 1, 0 while the slot is empty
+} ngramSlot;
+
+// Value of a word in the token table
+typedef struct {
+    uint64_t id;                // token id
+    uint64_t hash;              // hash of the word, rolled into n-gram hashes
+} tokenValue;
+
+// A slot competing for the ranking
+typedef struct {
+    uint32_t gram;              // index of its record
+    uint64_t count;             // occurrences
+} rankedGram;
+
+struct ngramCounter {
+    size_t size;                // words per n-gram
+    size_t stride;              // 32-bit words per record: the count, then size token ids
+    hashTable *tokens;          // word -> tokenValue, keys in an arena
+    const char **tokenWords;    // word of each token id, owned by tokens
+    size_t tokenCount;          // token ids handed out
+    size_t tokenCapacity;       // entries of tokenWords
+    ngramSlot *slots;           // the n-gram table, linear probing
+    size_t capacity;            // slots, a power of two
+    unsigned int capacityBits;  // log2(capacity)
+    size_t length;              // distinct n-grams
+    size_t growThreshold;       // length at which slots doubles
+    uint32_t *grams;            // one record per n-gram, in insertion order
+    size_t gramCapacity;        // records that fit in grams
+    uint32_t window[NGRAMCOUNTER_MAX_SIZE]; // token ids of the last words, oldest first
+    uint64_t windowHashes[NGRAMCOUNTER_MAX_SIZE]; // their hashes
+    size_t filled;              // words in window
+    uint64_t rollingHash;       // hash of the words in window
+    uint64_t dropFactor;        // NGRAM_HASH_BASE^(size - 1), weight of the oldest word
+    uint64_t total;             // n-grams counted
+    char *phrases;              // phrases of the last ranking
+};
+
+static const tokenValue *findToken(ngramCounter *counter, const char *word, size_t length);
+static bool countGram(ngramCounter *counter);
+static ngramSlot *findSlot(ngramCounter *counter, uint32_t tag, const uint32_t *ids);
+static bool growSlots(ngramCounter *counter);
+static inline uint32_t hashTag(uint64_t hash);
+static inline uint32_t *gramRecord(const ngramCounter *counter, uint32_t gram);
+static inline uint64_t recordCount(const uint32_t *record);
+static inline void setRecordCount(uint32_t *record, uint64_t count);
+static int cmpGram(const ngramCounter *counter, const rankedGram *a, const rankedGram *b);
+static void siftDown(const ngramCounter *counter, rankedGram *heap, size_t size, size_t index);
+
+ngramCounter *ngramCounter_create(size_t size) {
+    if (size == 0 || size > NGRAMCOUNTER_MAX_SIZE) {
+        return NULL;
+    }
+    ngramCounter *counter = (ngramCounter *)calloc(1, sizeof(ngramCounter));
+    if (counter == NULL) {
+        return NULL;
+    }
+    counter->size = size;
+    counter->stride = 2 + size;
+    counter->dropFactor = 1;
+    for (size_t i = 1; i < size; i++) {
+        counter->dropFactor *= NGRAM_HASH_BASE;
+    }
+
+    hashTable_config tokenConfig = { 0, 0.0, true, 0, sizeof(tokenValue), HASH_FUNCTION_DEFAULT, false, false };
+    counter->tokens = hashTable_create(&tokenConfig);
+    counter->capacityBits = 3;
+    while (((size_t)1 << counter->capacityBits) < (size_t)NGRAMCOUNTER_DEFAULT_CAPACITY) {
+        counter->capacityBits++;
+    }
+    counter->capacity = (size_t)1 << counter->capacityBits;
+    counter->growThreshold = (size_t)((double)counter->capacity * NGRAMCOUNTER_MAX_LOAD_FACTOR);
+    counter->slots = (ngramSlot *)calloc(counter->capacity, sizeof(ngramSlot));
+    STATS_ALLOCATION(sizeof(ngramCounter) + counter->capacity * sizeof(ngramSlot));
+    if (counter->tokens == NULL || counter->slots == NULL) {
+        ngramCounter_destroy(counter);
+        return NULL;
+    }
+    return counter;
+}
+
+void ngramCounter_destroy(ngramCounter *counter) {
+    if (counter == NULL) {
+        return;
+    }
+    hashTable_destroy(counter->tokens);
+    free((void *)counter->tokenWords);
+    free(counter->slots);
+    free(counter->grams);
+    free(counter->phrases);
+    free(counter);
+}
+
+bool ngramCounter_addWord(const char *word, size_t length, void *context) {
+    ngramCounter *counter = (ngramCounter *)context;
+    const tokenValue *token = findToken(counter, word, length);
+    if (token == NULL) {
+        return false;
+    }
+
+    // Roll the oldest word out of the window and hash, then the new one in
+    if (counter->filled == counter->size) {
+        counter->rollingHash -= counter->windowHashes[0] * counter->dropFactor;
+        memmove(counter->window, counter->window + 1, (counter->size - 1) * sizeof(uint32_t));
+        memmove(counter->windowHashes, counter->windowHashes + 1, (counter->size - 1) * sizeof(uint64_t));
+        counter->filled--;
+    }
+    counter->window[counter->filled] = (uint32_t)token->id;
+    counter->windowHashes[counter->filled++] = token->hash;
+    counter->rollingHash = counter->rollingHash * NGRAM_HASH_BASE + token->hash;
+
+    return counter->filled < counter->size || countGram(counter);
+}
+
+void ngramCounter_breakSequence(ngramCounter *counter) {
+    counter->filled = 0;
+    counter->rollingHash = 0;
+}
+
+bool ngramCounter_top(ngramCounter *counter, size_t n, WordCount *result, size_t *selected) {
+    *selected = 0;
+    if (n > counter->length) {
+        n = counter->length;
+    }
+    rankedGram *heap = (rankedGram *)malloc((n + 1) * sizeof(rankedGram));
+    if (heap == NULL) {
+        return false;
+    }
+
+    // Keep the n best n-grams in a heap with the worst at the root
+    size_t size = 0;
+    for (size_t i = 0; n > 0 && i < counter->capacity; i++) {
+        const ngramSlot *slot = &counter->slots[i];
+        if (slot->gram == 0) {
+            continue;
+        }
+        rankedGram candidate = { slot->gram - 1, recordCount(gramRecord(counter, slot->gram - 1)) };
+        if (size < n) {
+            // Sift the new n-gram up while it ranks after its parent
+            size_t index = size++;
+            while (index > 0 && cmpGram(counter, &candidate, &heap[(index - 1) / 2]) > 0) {
+                heap[index] = heap[(index - 1) / 2];
+                index = (index - 1) / 2;
+            }
+            heap[index] = candidate;
+        } else if (cmpGram(counter, &candidate, &heap[0]) < 0) {
+            heap[0] = candidate;
+            siftDown(counter, heap, size, 0);
+        }
+    }
+
+    // Heap sort, moving the worst to the end, leaves the best first
+    for (size_t end = size; end > 1; end--) {
+        rankedGram worst = heap[0];
+        heap[0] = heap[end - 1];
+        heap[end - 1] = worst;
+        siftDown(counter, heap, end - 1, 0);
+    }
+
+    // Join the words of the ranked n-grams only, into one buffer
+    size_t bytes = 0;
+    for (size_t i = 0; i < size; i++) {
+        const uint32_t *ids = gramRecord(counter, heap[i].gram) + 2;
+        for (size_t w = 0; w < counter->size; w++) {
+            bytes += strlen(counter->tokenWords[ids[w]]) + 1;
+        }
+    }
+    free(counter->phrases);
+    counter->phrases = (char *)malloc(bytes + 1);
+    STATS_ALLOCATION(bytes + 1);
+    if (counter->phrases == NULL) {
+        free(heap);
+        return false;
+    }
+    char *out = counter->phrases;
+    for (size_t i = 0; i < size; i++) {
+        const uint32_t *ids = gramRecord(counter, heap[i].gram) + 2;
+        result[i].word = out;
+        result[i].count = heap[i].count;
+        for (size_t w = 0; w < counter->size; w++) {
+            size_t wordLength = strlen(counter->tokenWords[ids[w]]);
+            memcpy(out, counter->tokenWords[ids[w]], wordLength);
+            out += wordLength;
+            *out++ = (w + 1 < counter->size) ? ' ' : '\0';
+        }
+    }
+    *selected = size;
+    free(heap);
+    return true;
+}
+
+uint64_t ngramCounter_count(ngramCounter *counter, const char *phrase, size_t length) {
+    uint32_t ids[NGRAMCOUNTER_MAX_SIZE];
+    uint64_t hash = 0;
+    size_t words = 0;
+    size_t start = 0;
+
+    // Every word must be a known token, and there must be exactly size of them
+    for (size_t i = 0; i <= length; i++) {
+        if (i < length && phrase[i] != ' ') {
+            continue;
+        }
+        if (words == counter->size) {
+            return 0;
+        }
+        const tokenValue *token = (const tokenValue *)hashTable_lookupLen(counter->tokens, phrase + start, i - start);
+        if (token == NULL) {
+            return 0;
+        }
+        ids[words++] = (uint32_t)token->id;
+        hash = hash * NGRAM_HASH_BASE + token->hash;
+        start = i + 1;
+    }
+    if (words != counter->size) {
+        return 0;
+    }
+    const ngramSlot *slot = findSlot(counter, hashTag(hash), ids);
+    return (slot->gram != 0) ? recordCount(gramRecord(counter, slot->gram - 1)) : 0;
+}
+
+size_t ngramCounter_getLength(ngramCounter *counter) {
+    return counter->length;
+}
+
+uint64_t ngramCounter_getTotal(ngramCounter *counter) {
+    return counter->total;
+}
+
+size_t ngramCounter_getTokenCount(ngramCounter *counter) {
+    return counter->tokenCount;
+}
+
+size_t ngramCounter_getMemory(ngramCounter *counter) {
+    return counter->capacity * sizeof(ngramSlot) +
+           counter->gramCapacity * counter->stride * sizeof(uint32_t) +
+           counter->tokenCapacity * sizeof(const char *) +
+           hashTable_getMemoryUsage(counter->tokens);
+}
+
+// The id and hash of a word, handing out the next id to a new word
+static const tokenValue *findToken(ngramCounter *counter, const char *word, size_t length) {
+    tokenValue next = { counter->tokenCount, 0 };
+    tokenValue *token = (tokenValue *)hashTable_findOrInsertLen(counter->tokens, word, length, &next);
+    if (token == NULL || token->id != next.id) {
+        return token;
+    }
+
+    // A new word: hash it and remember its key
+    if (counter->tokenCount == UINT32_MAX) {
+        return NULL; // Ids are 32-bit
+    }
+    if (counter->tokenCount == counter->tokenCapacity) {
+        size_t newCapacity = (counter->tokenCapacity == 0) ? 1024 : counter->tokenCapacity * 2;
+        const char **words = (const char **)realloc((void *)counter->tokenWords, newCapacity * sizeof(const char *));
+        STATS_ALLOCATION(newCapacity * sizeof(const char *));
+        if (words == NULL) {
+            return NULL;
+        }
+        counter->tokenWords = words;
+        counter->tokenCapacity = newCapacity;
+    }
+    token->hash = hashFunctions_wyhash(word, length, 0);
+    // The key copy lives in the arena and never moves, unlike the entry
+    counter->tokenWords[next.id] = hashTable_valueEntry(counter->tokens, token)->key;
+    counter->tokenCount++;
+    return token;
+}
+
+// Count the n-gram held in the window
+static bool countGram(ngramCounter *counter) {
+    uint32_t tag = hashTag(counter->rollingHash);
+    ngramSlot *slot = findSlot(counter, tag, counter->window);
+    if (slot->gram != 0) {
+        uint32_t *record = gramRecord(counter, slot->gram - 1);
+        setRecordCount(record, recordCount(record) + 1);
+        counter->total++;
+        return true;
+    }
+
+    // A new n-gram: claim a slot, then write its record
+    if (counter->length + 1 > counter->growThreshold) {
+        if (!growSlots(counter)) {
+            return false;
+        }
+        slot = findSlot(counter, tag, counter->window);
+    }
+    if (counter->length == counter->gramCapacity) {
+        size_t newCapacity = (counter->gramCapacity == 0) ? 1024 : counter->gramCapacity * 2;
+        if (newCapacity > UINT32_MAX) {
+            return false; // Records are numbered with 32 bits
+        }
+        uint32_t *grams = (uint32_t *)realloc(counter->grams, newCapacity * counter->stride * sizeof(uint32_t));
+        STATS_ALLOCATION(newCapacity * counter->stride * sizeof(uint32_t));
+        if (grams == NULL) {
+            return false;
+        }
+        counter->grams = grams;
+        counter->gramCapacity = newCapacity;
+    }
+    uint32_t *record = gramRecord(counter, (uint32_t)counter->length);
+    setRecordCount(record, 1);
+    memcpy(record + 2, counter->window, counter->size * sizeof(uint32_t));
+    slot->tag = tag;
+    slot->gram = (uint32_t)++counter->length;
+    counter->total++;
+    return true;
+}
+
+// The slot of an n-gram, or the empty slot where it belongs
+static ngramSlot *findSlot(ngramCounter *counter, uint32_t tag, const uint32_t *ids) {
+    size_t mask = counter->capacity - 1;
+    size_t index = tag >> (32u - counter->capacityBits);
+    while (true) {
+        ngramSlot *slot = &counter->slots[index];
+        if (slot->gram == 0) {
+            return slot;
+        }
+        // Compare the tag first, then the token ids of the record
+        if (slot->tag == tag &&
+            memcmp(gramRecord(counter, slot->gram - 1) + 2, ids, counter->size * sizeof(uint32_t)) == 0) {
+            return slot;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+static bool growSlots(ngramCounter *counter) {
+    if (counter->capacityBits == NGRAM_MAX_CAPACITY_BITS) {
+        return false; // The tags have no bit left to place more slots
+    }
+    size_t newCapacity = counter->capacity * 2;
+    ngramSlot *slots = (ngramSlot *)calloc(newCapacity, sizeof(ngramSlot));
+    if (slots == NULL) {
+        return false;
+    }
+    STATS_ALLOCATION(newCapacity * sizeof(ngramSlot));
+    ngramSlot *oldSlots = counter->slots;
+    size_t oldCapacity = counter->capacity;
+    counter->slots = slots;
+    counter->capacity = newCapacity;
+    counter->capacityBits++;
+    counter->growThreshold = (size_t)((double)newCapacity * NGRAMCOUNTER_MAX_LOAD_FACTOR);
+
+    // Re-place every n-gram by its tag, no record is read
+    size_t mask = newCapacity - 1;
+    for (size_t i = 0; i < oldCapacity; i++) {
+        if (oldSlots[i].gram == 0) {
+            continue;
+        }
+        size_t index = oldSlots[i].tag >> (32u - counter->capacityBits);
+        while (slots[index].gram != 0) {
+            index = (index + 1) & mask;
+        }
+        slots[index] = oldSlots[i];
+    }
+    free(oldSlots);
+    return true;
+}
+
+// Fibonacci hashing as in hashTable.c, the top bits pick the slot and the rest tell n-grams apart
+static inline uint32_t hashTag(uint64_t hash) {
+    return (uint32_t)((hash * UINT64_C(0x9E3779B97F4A7C15)) >> 32);
+}
+
+static inline uint32_t *gramRecord(const ngramCounter *counter, uint32_t gram) {
+    return counter->grams + (size_t)gram * counter->stride;
+}
+
+// The count spans the first two words of a record, which are only 4-byte aligned
+static inline uint64_t recordCount(const uint32_t *record) {
+    uint64_t count;
+    memcpy(&count, record, sizeof(count));
+    return count;
+}
+
+static inline void setRecordCount(uint32_t *record, uint64_t count) {
+    memcpy(record, &count, sizeof(count));
+}
+
+// Ranking order of two n-grams: count descending, then phrase ascending
+static int cmpGram(const ngramCounter *counter, const rankedGram *a, const rankedGram *b) {
+    if (a->count != b->count) {
+        return (a->count > b->count) ? -1 : 1;
+    }
+    // Order as strcmp() of the joined phrases would, without joining them:
+    // the first differing words decide, a word ending early continuing with
+    // the space (or the terminator) that follows it
+    const uint32_t *idsA = gramRecord(counter, a->gram) + 2;
+    const uint32_t *idsB = gramRecord(counter, b->gram) + 2;
+    for (size_t w = 0; w < counter->size; w++) {
+        if (idsA[w] == idsB[w]) {
+            continue;
+        }
+        const unsigned char *wordA = (const unsigned char *)counter->tokenWords[idsA[w]];
+        const unsigned char *wordB = (const unsigned char *)counter->tokenWords[idsB[w]];
+        while (*wordA != '\0' && *wordA == *wordB) {
+            wordA++;
+            wordB++;
+        }
+        int next = (w + 1 < counter->size) ? ' ' : '\0';
+        int byteA = (*wordA != '\0') ? *wordA : next;
+        int byteB = (*wordB != '\0') ? *wordB : next;
+        return byteA - byteB;
+    }
+    return 0;
+}
+
+// Restore the heap below index, the worst ranked n-gram at the root
+static void siftDown(const ngramCounter *counter, rankedGram *heap, size_t size, size_t index) {
+    while (true) {
+        size_t worst = index;
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+        if (left < size && cmpGram(counter, &heap[left], &heap[worst]) > 0) {
+            worst = left;
+        }
+        if (right < size && cmpGram(counter, &heap[right], &heap[worst]) > 0) {
+            worst = right;
+        }
+        if (worst == index) {
+            return;
+        }
+        rankedGram swap = heap[index];
+        heap[index] = heap[worst];
+        heap[worst] = swap;
+        index = worst;
+    }
+}
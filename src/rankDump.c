@@ -0,0 +1,322 @@
+/*
+ * Most Frequent Words - Ranking of a whole vocabulary
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rankDump_cfg.h"
+#include "rankDump.h"
+
+// Written as a native integer, reads back differently on a machine of the other byte order
+#define RANKDUMP_BYTE_ORDER (0x01020304u)
+// Longest decimal uint64_t
+#define RANKDUMP_MAX_DIGITS (20)
+
+// A word being ranked: its entry and count, and 8 bytes of its word as one integer
+typedef struct {
+    uint64_t chunk;         // bytes 8 * depth onwards in strcmp order, see loadChunk()
+    const ht_entry *entry;  // table entry of the word, see hashTable_valueEntry()
+    uint64_t count;         // count of the word
+} RankedWord;
+
+// Buffered output of a dump
+typedef struct {
+    FILE *file;
+    char *block;            // bytes not yet written
+    size_t used;            // bytes in block
+    rankDump_format format;
+    bool ok;                // false once a write failed
+} RankWriter;
+
+static RankedWord *rankEntries(hashTable *freqMap, uint64_t *total);
+static uint64_t loadChunk(const ht_entry *entry, size_t depth);
+static int compareFrom(const ht_entry *a, const ht_entry *b, size_t offset);
+static int compareRanked(const void *a, const void *b);
+static void sortByWord(RankedWord *words, size_t count, size_t depth);
+static bool writeWord(const char *word, size_t length, uint64_t count, void *context);
+static void writeBytes(RankWriter *writer, const void *data, size_t length);
+static void flushBlock(RankWriter *writer);
+
+bool rankDump_rankTable(hashTable *freqMap, rankDump_callback callback, void *context) {
+    uint64_t total = 0;
+    RankedWord *ranked = rankEntries(freqMap, &total);
+    if (ranked == NULL) {
+        return false;
+    }
+    size_t length = hashTable_getLength(freqMap);
+    bool ok = true;
+    for (size_t i = 0; ok && i < length; i++) {
+        const ht_entry *entry = ranked[i].entry;
+        ok = callback(entry->key, entry->length, ranked[i].count, context);
+    }
+    free(ranked);
+    return ok;
+}
+
+bool rankDump_writeTable(const char *path, hashTable *freqMap, rankDump_format format) {
+    uint64_t total = 0;
+    RankedWord *ranked = rankEntries(freqMap, &total);
+    if (ranked == NULL) {
+        return false;
+    }
+
+    size_t pathLength = strlen(path);
+    char *tmpPath = (char *)malloc(pathLength + sizeof(".tmp"));
+    RankWriter writer = { NULL, (char *)malloc(RANKDUMP_WRITE_BUFFER), 0, format, true };
+    if (tmpPath != NULL) {
+        memcpy(tmpPath, path, pathLength);
+        memcpy(tmpPath + pathLength, ".tmp", sizeof(".tmp"));
+        writer.file = fopen(tmpPath, "wb");
+    }
+    if (writer.file == NULL || writer.block == NULL) {
+        if (writer.file != NULL) {
+            fclose(writer.file);
+            remove(tmpPath);
+        }
+        free(tmpPath);
+        free(writer.block);
+        free(ranked);
+        return false;
+    }
+
+    size_t length = hashTable_getLength(freqMap);
+    if (format == RANKDUMP_BINARY) {
+        rankDump_header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, RANKDUMP_MAGIC, sizeof(header.magic));
+        header.version = RANKDUMP_VERSION;
+        header.byte_order = RANKDUMP_BYTE_ORDER;
+        header.word_count = length;
+        header.total_count = total;
+        writeBytes(&writer, &header, sizeof(header));
+    }
+    for (size_t i = 0; i < length; i++) {
+        const ht_entry *entry = ranked[i].entry;
+        writeWord(entry->key, entry->length, ranked[i].count, &writer);
+    }
+    flushBlock(&writer);
+    free(ranked);
+
+    bool ok = (fclose(writer.file) == 0) && writer.ok;
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows
+    if (ok) {
+        remove(path);
+    }
+#endif
+    ok = ok && rename(tmpPath, path) == 0;
+    if (!ok) {
+        remove(tmpPath);
+    }
+    free(tmpPath);
+    free(writer.block);
+    return ok;
+}
+
+// Every entry of the table in ranking order, the caller frees the array
+static RankedWord *rankEntries(hashTable *freqMap, uint64_t *total) {
+    size_t length = hashTable_getLength(freqMap);
+    RankedWord *ranked = (RankedWord *)malloc((length + 1) * sizeof(RankedWord));
+    size_t *next = (size_t *)calloc(RANKDUMP_COUNT_BUCKETS, sizeof(size_t));
+    if (ranked == NULL || next == NULL) {
+        free(ranked);
+        free(next);
+        return NULL;
+    }
+
+    // First pass: how many words have each small count, and how many a larger one
+    hashTable_iterator iter;
+    const char *key;
+    void *value;
+    size_t large = 0;
+    *total = 0;
+    hashTable_initIterator(freqMap, &iter);
+    while (hashTable_iteratorNext(&iter, &key, &value)) {
+        // Words are reached through their entries, which only inline counts have
+        if (hashTable_valueEntry(freqMap, value) == NULL) {
+            free(ranked);
+            free(next);
+            return NULL;
+        }
+        uint64_t count = *(const uint64_t *)value;
+        *total += count;
+        if (count < RANKDUMP_COUNT_BUCKETS) {
+            next[count]++;
+        } else {
+            large++;
+        }
+    }
+
+    // Large counts rank first, then the buckets from the highest count down
+    size_t position = large;
+    for (size_t count = RANKDUMP_COUNT_BUCKETS; count-- > 0;) {
+        size_t words = next[count];
+        next[count] = position;
+        position += words;
+    }
+
+    // Second pass: drop every entry into its place, with the first bytes of
+    // its word read while the slot is at hand
+    size_t largeUsed = 0;
+    hashTable_initIterator(freqMap, &iter);
+    while (hashTable_iteratorNext(&iter, &key, &value)) {
+        const ht_entry *entry = hashTable_valueEntry(freqMap, value);
+        uint64_t count = *(const uint64_t *)value;
+        size_t index = (count < RANKDUMP_COUNT_BUCKETS) ? next[count]++ : largeUsed++;
+        ranked[index].chunk = loadChunk(entry, 0);
+        ranked[index].entry = entry;
+        ranked[index].count = count;
+    }
+
+    // Only ties are left to order: the large counts among themselves, and
+    // the words of each bucket (next[count] now ends bucket count)
+    qsort(ranked, large, sizeof(RankedWord), compareRanked);
+    size_t start = large;
+    for (size_t count = RANKDUMP_COUNT_BUCKETS; count-- > 0;) {
+        sortByWord(ranked + start, next[count] - start, 0);
+        start = next[count];
+    }
+    free(next);
+    return ranked;
+}
+
+// Bytes 8 * depth to 8 * depth + 7 of a word, first byte most significant
+// and zero past the end: words hold no NUL byte, so chunks compare as the
+// words do with strcmp, and a chunk whose last byte is 0 ends its word
+static uint64_t loadChunk(const ht_entry *entry, size_t depth) {
+    size_t offset = depth * 8;
+    size_t available = (entry->length > offset) ? entry->length - offset : 0;
+    size_t bytes = (available < 8) ? available : 8;
+    uint64_t chunk = 0;
+    for (size_t i = 0; i < 8; i++) {
+        chunk = (chunk << 8) | ((i < bytes) ? (unsigned char)entry->key[offset + i] : 0u);
+    }
+    return chunk;
+}
+
+// Order of two words whose first offset bytes are equal, the order of strcmp
+static int compareFrom(const ht_entry *a, const ht_entry *b, size_t offset) {
+    size_t shorter = (a->length < b->length) ? a->length : b->length;
+    int order = (shorter > offset) ? memcmp(a->key + offset, b->key + offset, shorter - offset) : 0;
+    if (order != 0) {
+        return order;
+    }
+    return (a->length < b->length) ? -1 : (a->length > b->length);
+}
+
+// Ranking order of cmpWordCount() on ranked words
+static int compareRanked(const void *a, const void *b) {
+    const RankedWord *wordA = (const RankedWord *)a;
+    const RankedWord *wordB = (const RankedWord *)b;
+    if (wordA->count != wordB->count) {
+        return (wordA->count > wordB->count) ? -1 : 1;
+    }
+    if (wordA->chunk != wordB->chunk) {
+        return (wordA->chunk < wordB->chunk) ? -1 : 1;
+    }
+    return compareFrom(wordA->entry, wordB->entry, 0);
+}
+
+// Multikey quicksort (Bentley and Sedgewick) over 8-byte chunks: a three-way
+// partition on the chunk at depth, then only the equal part loads its next
+// chunk. Most words differ in their first chunk, which is kept next to the
+// entry pointer, so they are ordered without reading the words again.
+// Words are distinct, so no run of equal words remains.
+static void sortByWord(RankedWord *words, size_t count, size_t depth) {
+    while (count > RANKDUMP_INSERTION_SORT) {
+        uint64_t pivot = words[count / 2].chunk;
+        size_t less = 0;
+        size_t i = 0;
+        size_t greater = count;
+        while (i < greater) {
+            RankedWord swap = words[i];
+            if (swap.chunk < pivot) {
+                words[i++] = words[less];
+                words[less++] = swap;
+            } else if (swap.chunk > pivot) {
+                words[i] = words[--greater];
+                words[greater] = swap;
+            } else {
+                i++;
+            }
+        }
+        sortByWord(words, less, depth);
+        sortByWord(words + greater, count - greater, depth);
+        if ((pivot & 0xFF) == 0) {
+            return; // Words ending in this chunk are equal, at most one of them
+        }
+        words += less;
+        count = greater - less;
+        depth++;
+        for (i = 0; i < count; i++) {
+            words[i].chunk = loadChunk(words[i].entry, depth);
+        }
+    }
+
+    for (size_t i = 1; i < count; i++) {
+        RankedWord word = words[i];
+        size_t j = i;
+        while (j > 0 && (words[j - 1].chunk > word.chunk ||
+                         (words[j - 1].chunk == word.chunk &&
+                          compareFrom(words[j - 1].entry, word.entry, depth * 8) > 0))) {
+            words[j] = words[j - 1];
+            j--;
+        }
+        words[j] = word;
+    }
+}
+
+// Append one word in the writer's format
+static bool writeWord(const char *word, size_t length, uint64_t count, void *context) {
+    RankWriter *writer = (RankWriter *)context;
+    if (writer->format == RANKDUMP_BINARY) {
+        uint32_t wordLength = (uint32_t)length;
+        writeBytes(writer, &count, sizeof(count));
+        writeBytes(writer, &wordLength, sizeof(wordLength));
+        writeBytes(writer, word, length);
+        return writer->ok;
+    }
+
+    // Decimal digits are produced from the end
+    char line[RANKDUMP_MAX_DIGITS + 2];
+    char *digits = line + sizeof(line);
+    *--digits = '\n';
+    do {
+        *--digits = (char)('0' + count % 10);
+        count /= 10;
+    } while (count > 0);
+    *--digits = '\t';
+    writeBytes(writer, word, length);
+    writeBytes(writer, digits, (size_t)(line + sizeof(line) - digits));
+    return writer->ok;
+}
+
+static void writeBytes(RankWriter *writer, const void *data, size_t length) {
+    const char *bytes = (const char *)data;
+    while (length > 0) {
+        size_t room = RANKDUMP_WRITE_BUFFER - writer->used;
+        size_t chunk = (length < room) ? length : room;
+        memcpy(writer->block + writer->used, bytes, chunk);
+        writer->used += chunk;
+        bytes += chunk;
+        length -= chunk;
+        if (writer->used == RANKDUMP_WRITE_BUFFER) {
+            flushBlock(writer);
+        }
+    }
+}
+
+static void flushBlock(RankWriter *writer) {
+    if (writer->used == 0) {
+        return;
+    }
+    writer->ok = writer->ok && fwrite(writer->block, 1, writer->used, writer->file) == writer->used;
+    writer->used = 0;
+}
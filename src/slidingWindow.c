@@ -0,0 +1,300 @@
+/*
+ * Most Frequent Words - Sliding window counts
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "slidingWindow_cfg.h"
+#include "slidingWindow.h"
+#include "hashTable.h"
+#include "wordScanner.h"
+
+// Value of a word in the window table
+typedef struct {
+    uint64_t count;             // occurrences in the window, first so topN_select() reads it
+    uint64_t leader;            // position in leaders + 1, 0 when not ranked
+} windowCount;
+
+struct slidingWindow {
+    hashTable *counts;          // word -> windowCount over the whole window, keys freed on delete
+    hashTable **buckets;        // word -> uint64_t count of one time span, NULL while empty
+    size_t bucketCount;         // buckets in the ring
+    uint64_t bucketWidth;       // time units per bucket
+    uint64_t newest;            // number (time / bucketWidth) of the newest bucket
+    bool started;               // a time was seen, newest is meaningful
+    WordCount *leaders;         // best words of the window in no particular order
+    size_t leaderCount;         // words in leaders
+    size_t topCapacity;         // slots in leaders
+    size_t worst;               // position of the worst ranked leader
+    uint64_t total;             // sum of all counts
+    uint64_t dropped;           // words older than the window
+    wordScanner scanner;        // splits text given to slidingWindow_addText()
+    uint64_t scanTime;          // time of the text being scanned
+};
+
+static hashTable *createBucket(void);
+static bool slide(slidingWindow *window, uint64_t bucket);
+static void expireBucket(slidingWindow *window, size_t slot);
+static windowCount *findCount(slidingWindow *window, const char *word);
+static void offerLeader(slidingWindow *window, windowCount *count);
+static void findWorst(slidingWindow *window);
+static void clearLeaders(slidingWindow *window);
+static bool rankLeaders(slidingWindow *window);
+static bool addScannedWord(const char *word, size_t length, void *context);
+
+slidingWindow *slidingWindow_create(const slidingWindow_config *config) {
+    slidingWindow *window = (slidingWindow *)calloc(1, sizeof(slidingWindow));
+    if (window == NULL) {
+        return NULL;
+    }
+    window->bucketCount = (config != NULL && config->bucket_count > 0) ? config->bucket_count
+                                                                       : (size_t)SLIDINGWINDOW_DEFAULT_BUCKET_COUNT;
+    window->bucketWidth = (config != NULL && config->bucket_width > 0) ? config->bucket_width
+                                                                       : (uint64_t)SLIDINGWINDOW_DEFAULT_BUCKET_WIDTH;
+    window->topCapacity = (config != NULL && config->top_capacity > 0) ? config->top_capacity
+                                                                       : (size_t)SLIDINGWINDOW_DEFAULT_TOP_CAPACITY;
+
+    // Words come and go, so the window table frees keys one by one instead of using an arena
+    hashTable_config countsConfig = { 0, 0.0, false, 0, sizeof(windowCount), HASH_FUNCTION_DEFAULT, false, false };
+    window->counts = hashTable_create(&countsConfig);
+    window->buckets = (hashTable **)calloc(window->bucketCount, sizeof(hashTable *));
+    window->leaders = (WordCount *)malloc(window->topCapacity * sizeof(WordCount));
+    if (window->counts == NULL || window->buckets == NULL || window->leaders == NULL) {
+        slidingWindow_destroy(window);
+        return NULL;
+    }
+    wordScanner_init(&window->scanner, addScannedWord, window);
+    return window;
+}
+
+void slidingWindow_destroy(slidingWindow *window) {
+    if (window == NULL) {
+        return;
+    }
+    for (size_t i = 0; window->buckets != NULL && i < window->bucketCount; i++) {
+        hashTable_destroy(window->buckets[i]);
+    }
+    free(window->buckets);
+    hashTable_destroy(window->counts);
+    free(window->leaders);
+    wordScanner_destroy(&window->scanner);
+    free(window);
+}
+
+bool slidingWindow_add(slidingWindow *window, const char *word, size_t length, uint64_t time) {
+    uint64_t bucket = time / window->bucketWidth;
+    if (!window->started) {
+        window->newest = bucket;
+        window->started = true;
+    }
+    if (bucket > window->newest) {
+        if (!slide(window, bucket)) {
+            return false;
+        }
+    } else if (window->newest - bucket >= window->bucketCount) {
+        window->dropped++; // Already expired
+        return true;
+    }
+
+    // Count the word in its bucket, to subtract it when the bucket expires
+    size_t slot = (size_t)(bucket % window->bucketCount);
+    if (window->buckets[slot] == NULL) {
+        window->buckets[slot] = createBucket();
+        if (window->buckets[slot] == NULL) {
+            return false;
+        }
+    }
+    if (hashTable_incrementOrInsertLen(window->buckets[slot], word, length) == NULL) {
+        return false;
+    }
+
+    // And in the window
+    windowCount absent = { 0, 0 };
+    windowCount *count = (windowCount *)hashTable_findOrInsertLen(window->counts, word, length, &absent);
+    if (count == NULL) {
+        return false;
+    }
+    count->count++;
+    window->total++;
+    offerLeader(window, count);
+    return true;
+}
+
+bool slidingWindow_addText(slidingWindow *window, const char *text, size_t length, uint64_t time) {
+    window->scanTime = time;
+    return wordScanner_feed(&window->scanner, text, length) && wordScanner_finish(&window->scanner);
+}
+
+bool slidingWindow_advance(slidingWindow *window, uint64_t time) {
+    uint64_t bucket = time / window->bucketWidth;
+    if (!window->started || bucket <= window->newest) {
+        return true;
+    }
+    return slide(window, bucket);
+}
+
+bool slidingWindow_top(slidingWindow *window, size_t n, WordCount *result, size_t *selected) {
+    // Leaders hold every word of a small window, and the best words of a large one
+    if (n <= window->leaderCount || window->leaderCount == hashTable_getLength(window->counts)) {
+        size_t count = (n < window->leaderCount) ? n : window->leaderCount;
+        topN_heap heap;
+        topN_heapInit(&heap, result, count);
+        for (size_t i = 0; i < window->leaderCount; i++) {
+            topN_heapOffer(&heap, window->leaders[i].word, window->leaders[i].count);
+        }
+        *selected = topN_heapFinish(&heap);
+        return true;
+    }
+    return topN_select(window->counts, n, result, selected);
+}
+
+uint64_t slidingWindow_count(slidingWindow *window, const char *word, size_t length) {
+    const windowCount *count = (const windowCount *)hashTable_lookupLen(window->counts, word, length);
+    return (count != NULL) ? count->count : 0;
+}
+
+size_t slidingWindow_getLength(slidingWindow *window) {
+    return hashTable_getLength(window->counts);
+}
+
+uint64_t slidingWindow_getTotal(slidingWindow *window) {
+    return window->total;
+}
+
+uint64_t slidingWindow_getDropped(slidingWindow *window) {
+    return window->dropped;
+}
+
+// Counters of one time span, dropped whole when it expires
+static hashTable *createBucket(void) {
+    hashTable_config config = { 0, 0.0, true, 0, sizeof(uint64_t), HASH_FUNCTION_DEFAULT, false, false };
+    return hashTable_create(&config);
+}
+
+// Make bucket the newest, expiring every bucket that falls out of the window
+static bool slide(slidingWindow *window, uint64_t bucket) {
+    uint64_t steps = bucket - window->newest;
+    if (steps > window->bucketCount) {
+        steps = window->bucketCount;
+    }
+
+    // The ring slots about to be reused hold the oldest buckets
+    bool expiring = false;
+    for (uint64_t i = 1; i <= steps; i++) {
+        expiring = expiring || window->buckets[(window->newest + i) % window->bucketCount] != NULL;
+    }
+    window->newest = bucket;
+    if (!expiring) {
+        return true; // Nothing counted there, the ranking still holds
+    }
+
+    // Counts only fall here, so the leaders are ranked again from the window table
+    clearLeaders(window);
+    for (uint64_t i = 1; i <= steps; i++) {
+        expireBucket(window, (size_t)((bucket - steps + i) % window->bucketCount));
+    }
+    return rankLeaders(window);
+}
+
+// Subtract a bucket from the window and drop it
+static void expireBucket(slidingWindow *window, size_t slot) {
+    hashTable *expired = window->buckets[slot];
+    if (expired == NULL) {
+        return;
+    }
+
+    hashTable_iterator iter;
+    hashTable_initIterator(expired, &iter);
+    const char *word;
+    void *value;
+    while (hashTable_iteratorNext(&iter, &word, &value)) {
+        uint64_t expiredCount = *(const uint64_t *)value;
+        windowCount *count = findCount(window, word);
+        count->count -= expiredCount;
+        window->total -= expiredCount;
+        if (count->count == 0) {
+            hashTable_delete(window->counts, word);
+        }
+    }
+    hashTable_destroy(expired);
+    window->buckets[slot] = NULL;
+}
+
+static windowCount *findCount(slidingWindow *window, const char *word) {
+    return (windowCount *)hashTable_lookup(window->counts, word);
+}
+
+// Keep the leaders the best words after one of them, or count, went up by one
+static void offerLeader(slidingWindow *window, windowCount *count) {
+    // Keys of the counts table are allocated apart, so the word outlives slot moves
+    const char *word = hashTable_valueEntry(window->counts, count)->key;
+    WordCount candidate = { word, count->count };
+
+    if (count->leader != 0) {
+        size_t position = (size_t)count->leader - 1;
+        window->leaders[position].count = count->count;
+        if (position == window->worst) {
+            findWorst(window); // The worst may have overtaken another leader
+        }
+        return;
+    }
+    if (window->leaderCount < window->topCapacity) {
+        window->leaders[window->leaderCount] = candidate;
+        count->leader = ++window->leaderCount;
+        if (window->leaderCount == 1 || cmpWordCount(&candidate, &window->leaders[window->worst]) > 0) {
+            window->worst = window->leaderCount - 1;
+        }
+        return;
+    }
+
+    // Counts only grow between expiries, so a word that never beat the worst
+    // leader stays behind every leader until it does
+    if (cmpWordCount(&candidate, &window->leaders[window->worst]) < 0) {
+        findCount(window, window->leaders[window->worst].word)->leader = 0;
+        window->leaders[window->worst] = candidate;
+        count->leader = window->worst + 1;
+        findWorst(window);
+    }
+}
+
+static void findWorst(slidingWindow *window) {
+    window->worst = 0;
+    for (size_t i = 1; i < window->leaderCount; i++) {
+        if (cmpWordCount(&window->leaders[i], &window->leaders[window->worst]) > 0) {
+            window->worst = i;
+        }
+    }
+}
+
+// Unmark every leader, before counts fall and words are deleted
+static void clearLeaders(slidingWindow *window) {
+    for (size_t i = 0; i < window->leaderCount; i++) {
+        findCount(window, window->leaders[i].word)->leader = 0;
+    }
+    window->leaderCount = 0;
+    window->worst = 0;
+}
+
+// Pick the leaders from the whole window table
+static bool rankLeaders(slidingWindow *window) {
+    if (!topN_select(window->counts, window->topCapacity, window->leaders, &window->leaderCount)) {
+        return false;
+    }
+    for (size_t i = 0; i < window->leaderCount; i++) {
+        findCount(window, window->leaders[i].word)->leader = i + 1;
+    }
+    // Selected in ranking order, the worst comes last
+    window->worst = (window->leaderCount > 0) ? window->leaderCount - 1 : 0;
+    return true;
+}
+
+static bool addScannedWord(const char *word, size_t length, void *context) {
+    slidingWindow *window = (slidingWindow *)context;
+    return slidingWindow_add(window, word, length, window->scanTime);
+}
@@ -0,0 +1,476 @@
+/*
+ * Most Frequent Words - Binary frequency snapshots
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "snapshot.h"
+#include "fileReader.h"
+#include "hashFunctions.h"
+
+// Written as a native integer, reads back differently on a machine of the other byte order
+#define SNAPSHOT_BYTE_ORDER (0x01020304u)
+// The checksum chains wyhash over blocks of this many bytes, part of the format
+#define SNAPSHOT_CHECKSUM_BLOCK (65536)
+
+// A word to write: words are handed to the writer in strcmp order
+typedef struct {
+    const char *word;   // null-terminated word
+    size_t length;      // length of the word, excluding the terminator
+    uint64_t count;     // its count
+} SnapshotEntry;
+
+// Produces the words of a snapshot in order, several times over
+typedef struct {
+    bool (*next)(void *context, SnapshotEntry *entry);  // false once every word was produced
+    void (*rewind)(void *context);                      // start again from the first word
+    void *context;
+} SnapshotSource;
+
+// Buffered output that checksums the body in SNAPSHOT_CHECKSUM_BLOCK blocks
+typedef struct {
+    FILE *file;
+    unsigned char *block;   // bytes not yet written
+    size_t used;            // bytes in block
+    uint64_t checksum;      // chained over every full block written
+    bool ok;                // false once a write failed
+} SnapshotWriter;
+
+// Words of a table, sorted once
+typedef struct {
+    SnapshotEntry *entries;
+    size_t count;
+    size_t next;
+} TableSource;
+
+// Words of several snapshots, merged on the fly
+typedef struct {
+    const snapshot *inputs;
+    size_t count;
+    size_t *positions;      // next word of every input
+} MergeSource;
+
+static bool writeSnapshot(const char *path, SnapshotSource *source);
+static void writeBytes(SnapshotWriter *writer, const void *data, size_t length);
+static void writeU64(SnapshotWriter *writer, uint64_t value);
+static void flushBlock(SnapshotWriter *writer);
+static uint64_t bodyChecksum(const unsigned char *body, size_t length);
+static bool checkLayout(snapshot *snap, bool verify);
+static bool loadFile(const char *path, snapshot *snap);
+static int compareKey(const char *word, size_t length, const char *key, size_t keyLength);
+static int compareEntries(const void *a, const void *b);
+static bool nextTableWord(void *context, SnapshotEntry *entry);
+static void rewindTable(void *context);
+static bool nextMergedWord(void *context, SnapshotEntry *entry);
+static void rewindMerge(void *context);
+
+bool snapshot_writeTable(const char *path, hashTable *freqMap) {
+    size_t length = hashTable_getLength(freqMap);
+    TableSource table = { (SnapshotEntry *)malloc((length + 1) * sizeof(SnapshotEntry)), 0, 0 };
+    if (table.entries == NULL) {
+        return false;
+    }
+
+    hashTable_iterator iter;
+    hashTable_initIterator(freqMap, &iter);
+    const char *key;
+    void *value;
+    bool ok = true;
+    while (hashTable_iteratorNext(&iter, &key, &value)) {
+        // Only counts stored inline have an entry to take the key length from
+        const ht_entry *entry = hashTable_valueEntry(freqMap, value);
+        if (entry == NULL) {
+            ok = false;
+            break;
+        }
+        table.entries[table.count].word = key;
+        table.entries[table.count].length = entry->length;
+        table.entries[table.count].count = *(const uint64_t *)value;
+        table.count++;
+    }
+    qsort(table.entries, table.count, sizeof(SnapshotEntry), compareEntries);
+
+    SnapshotSource source = { nextTableWord, rewindTable, &table };
+    ok = ok && writeSnapshot(path, &source);
+    free(table.entries);
+    return ok;
+}
+
+bool snapshot_merge(const char *path, const snapshot *inputs, size_t count) {
+    MergeSource merge = { inputs, count, (size_t *)calloc(count + 1, sizeof(size_t)) };
+    if (merge.positions == NULL) {
+        return false;
+    }
+    SnapshotSource source = { nextMergedWord, rewindMerge, &merge };
+    bool ok = writeSnapshot(path, &source);
+    free(merge.positions);
+    return ok;
+}
+
+bool snapshot_isSnapshot(const char *path) {
+    char magic[sizeof(((snapshot_header *)0)->magic)];
+    struct stat info;
+
+    // Only regular files, peeking into a pipe would eat its first bytes
+    if (stat(path, &info) != 0 || !S_ISREG(info.st_mode)) {
+        return false;
+    }
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    bool found = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                 memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0;
+    fclose(file);
+    return found;
+}
+
+bool snapshot_open(const char *path, snapshot *snap, bool verify) {
+    memset(snap, 0, sizeof(snapshot));
+
+    // Mapped where possible, so opening costs nothing until words are touched
+    fileReader_mapping mapping;
+    if (fileReader_map(path, &mapping)) {
+        snap->data = mapping.data;
+        snap->length = mapping.length;
+        snap->mapped = true;
+    } else if (!loadFile(path, snap)) {
+        return false;
+    }
+
+    if (!checkLayout(snap, verify)) {
+        snapshot_close(snap);
+        return false;
+    }
+    return true;
+}
+
+void snapshot_close(snapshot *snap) {
+    if (snap->mapped) {
+        fileReader_mapping mapping = { (const char *)snap->data, snap->length };
+        fileReader_unmap(&mapping);
+    } else {
+        free((void *)snap->data);
+    }
+    memset(snap, 0, sizeof(snapshot));
+}
+
+size_t snapshot_getLength(const snapshot *snap) {
+    return (size_t)snap->header->word_count;
+}
+
+const char *snapshot_word(const snapshot *snap, size_t index, size_t *length) {
+    if (length != NULL) {
+        *length = (size_t)(snap->offsets[index + 1] - snap->offsets[index]) - 1;
+    }
+    return snap->keys + snap->offsets[index];
+}
+
+uint64_t snapshot_lookup(const snapshot *snap, const char *word, size_t length) {
+    size_t low = 0;
+    size_t high = snapshot_getLength(snap);
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        size_t keyLength;
+        const char *key = snapshot_word(snap, mid, &keyLength);
+        int order = compareKey(word, length, key, keyLength);
+        if (order == 0) {
+            return snap->counts[mid];
+        }
+        if (order < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return 0;
+}
+
+void snapshot_top(const snapshot *snap, size_t n, WordCount *result, size_t *selected) {
+    topN_heap heap;
+    topN_heapInit(&heap, result, n);
+
+    size_t length = snapshot_getLength(snap);
+    for (size_t i = 0; i < length; i++) {
+        topN_heapOffer(&heap, snapshot_word(snap, i, NULL), snap->counts[i]);
+    }
+    *selected = topN_heapFinish(&heap);
+}
+
+bool snapshot_addToTable(const snapshot *snap, hashTable *freqMap) {
+    size_t length = snapshot_getLength(snap);
+    for (size_t i = 0; i < length; i++) {
+        size_t wordLength;
+        const char *word = snapshot_word(snap, i, &wordLength);
+        if (hashTable_addCountLen(freqMap, word, wordLength, snap->counts[i]) == NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Write every word of source to path, through a temporary file renamed over it
+static bool writeSnapshot(const char *path, SnapshotSource *source) {
+    snapshot_header header;
+    SnapshotEntry entry;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+
+    // First pass: section sizes
+    source->rewind(source->context);
+    while (source->next(source->context, &entry)) {
+        header.word_count++;
+        header.total_count += entry.count;
+        header.key_bytes += entry.length + 1;
+    }
+
+    size_t pathLength = strlen(path);
+    char *tmpPath = (char *)malloc(pathLength + sizeof(".tmp"));
+    SnapshotWriter writer = { NULL, (unsigned char *)malloc(SNAPSHOT_CHECKSUM_BLOCK), 0, 0, true };
+    if (tmpPath != NULL) {
+        memcpy(tmpPath, path, pathLength);
+        memcpy(tmpPath + pathLength, ".tmp", sizeof(".tmp"));
+        writer.file = fopen(tmpPath, "wb");
+    }
+    if (writer.file == NULL || writer.block == NULL) {
+        if (writer.file != NULL) {
+            fclose(writer.file);
+            remove(tmpPath);
+        }
+        free(tmpPath);
+        free(writer.block);
+        return false;
+    }
+
+    // The header goes in last, once the checksum is known
+    writer.ok = fwrite(&header, sizeof(header), 1, writer.file) == 1;
+
+    // One more pass per section, so each is written front to back
+    source->rewind(source->context);
+    while (source->next(source->context, &entry)) {
+        writeU64(&writer, entry.count);
+    }
+    uint64_t offset = 0;
+    source->rewind(source->context);
+    while (source->next(source->context, &entry)) {
+        writeU64(&writer, offset);
+        offset += entry.length + 1;
+    }
+    writeU64(&writer, offset);
+    source->rewind(source->context);
+    while (source->next(source->context, &entry)) {
+        writeBytes(&writer, entry.word, entry.length + 1);
+    }
+    flushBlock(&writer);
+
+    header.checksum = writer.checksum;
+    bool ok = writer.ok && fseek(writer.file, 0, SEEK_SET) == 0 &&
+              fwrite(&header, sizeof(header), 1, writer.file) == 1;
+    ok = (fclose(writer.file) == 0) && ok;
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows
+    if (ok) {
+        remove(path);
+    }
+#endif
+    ok = ok && rename(tmpPath, path) == 0;
+    if (!ok) {
+        remove(tmpPath);
+    }
+    free(tmpPath);
+    free(writer.block);
+    return ok;
+}
+
+static void writeBytes(SnapshotWriter *writer, const void *data, size_t length) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    while (length > 0) {
+        size_t room = SNAPSHOT_CHECKSUM_BLOCK - writer->used;
+        size_t chunk = (length < room) ? length : room;
+        memcpy(writer->block + writer->used, bytes, chunk);
+        writer->used += chunk;
+        bytes += chunk;
+        length -= chunk;
+        if (writer->used == SNAPSHOT_CHECKSUM_BLOCK) {
+            flushBlock(writer);
+        }
+    }
+}
+
+static void writeU64(SnapshotWriter *writer, uint64_t value) {
+    writeBytes(writer, &value, sizeof(value));
+}
+
+static void flushBlock(SnapshotWriter *writer) {
+    if (writer->used == 0) {
+        return;
+    }
+    writer->checksum = hashFunctions_wyhash((const char *)writer->block, writer->used, writer->checksum);
+    writer->ok = writer->ok && fwrite(writer->block, 1, writer->used, writer->file) == writer->used;
+    writer->used = 0;
+}
+
+// Checksum of a body as computed by the writer, one wyhash per block seeded with the previous one
+static uint64_t bodyChecksum(const unsigned char *body, size_t length) {
+    uint64_t checksum = 0;
+    for (size_t start = 0; start < length; start += SNAPSHOT_CHECKSUM_BLOCK) {
+        size_t chunk = (length - start < SNAPSHOT_CHECKSUM_BLOCK) ? length - start : SNAPSHOT_CHECKSUM_BLOCK;
+        checksum = hashFunctions_wyhash((const char *)body + start, chunk, checksum);
+    }
+    return checksum;
+}
+
+// Validate the header and point the sections into the file
+static bool checkLayout(snapshot *snap, bool verify) {
+    const snapshot_header *header = (const snapshot_header *)snap->data;
+    if (snap->length < sizeof(snapshot_header) + sizeof(uint64_t) ||
+        memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != SNAPSHOT_VERSION || header->byte_order != SNAPSHOT_BYTE_ORDER) {
+        return false;
+    }
+
+    // Sections must exactly fill the file
+    size_t body = snap->length - sizeof(snapshot_header);
+    uint64_t words = header->word_count;
+    if (words > (body - sizeof(uint64_t)) / (2 * sizeof(uint64_t)) ||
+        header->key_bytes != body - sizeof(uint64_t) - words * 2 * sizeof(uint64_t)) {
+        return false;
+    }
+    snap->header = header;
+    snap->counts = (const uint64_t *)(header + 1);
+    snap->offsets = snap->counts + words;
+    snap->keys = (const char *)(snap->offsets + words + 1);
+    if (snap->offsets[words] != header->key_bytes ||
+        (words > 0 && snap->keys[header->key_bytes - 1] != '\0')) {
+        return false;
+    }
+    if (!verify) {
+        return true;
+    }
+
+    if (bodyChecksum((const unsigned char *)(header + 1), body) != header->checksum ||
+        snap->offsets[0] != 0) {
+        return false;
+    }
+    // Every word is terminated where the next one starts, and sorted after the previous one
+    uint64_t total = 0;
+    for (size_t i = 0; i < words; i++) {
+        uint64_t start = snap->offsets[i];
+        uint64_t end = snap->offsets[i + 1];
+        if (end <= start || end > header->key_bytes || snap->keys[end - 1] != '\0' ||
+            memchr(snap->keys + start, '\0', (size_t)(end - start - 1)) != NULL ||
+            (i > 0 && strcmp(snap->keys + snap->offsets[i - 1], snap->keys + start) >= 0)) {
+            return false;
+        }
+        total += snap->counts[i];
+    }
+    return total == header->total_count;
+}
+
+// Read a whole file into memory, for files that cannot be mapped
+static bool loadFile(const char *path, snapshot *snap) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    size_t capacity = 65536;
+    size_t length = 0;
+    char *data = (char *)malloc(capacity);
+    while (data != NULL) {
+        length += fread(data + length, 1, capacity - length, file);
+        if (length < capacity) {
+            break;
+        }
+        char *grown = (char *)realloc(data, capacity * 2);
+        if (grown == NULL) {
+            free(data);
+            data = NULL;
+            break;
+        }
+        data = grown;
+        capacity *= 2;
+    }
+    bool ok = data != NULL && !ferror(file);
+    fclose(file);
+    if (!ok) {
+        free(data);
+        return false;
+    }
+    snap->data = data;
+    snap->length = length;
+    snap->mapped = false;
+    return true;
+}
+
+// Order of a word against a snapshot key, the order of strcmp
+static int compareKey(const char *word, size_t length, const char *key, size_t keyLength) {
+    int order = memcmp(word, key, (length < keyLength) ? length : keyLength);
+    if (order != 0) {
+        return order;
+    }
+    return (length < keyLength) ? -1 : (length > keyLength);
+}
+
+static int compareEntries(const void *a, const void *b) {
+    return strcmp(((const SnapshotEntry *)a)->word, ((const SnapshotEntry *)b)->word);
+}
+
+static bool nextTableWord(void *context, SnapshotEntry *entry) {
+    TableSource *table = (TableSource *)context;
+    if (table->next == table->count) {
+        return false;
+    }
+    *entry = table->entries[table->next++];
+    return true;
+}
+
+static void rewindTable(void *context) {
+    ((TableSource *)context)->next = 0;
+}
+
+// Smallest word at the head of any input, with the counts of every input holding it
+static bool nextMergedWord(void *context, SnapshotEntry *entry) {
+    MergeSource *merge = (MergeSource *)context;
+    const char *smallest = NULL;
+
+    // Inputs are few, a linear scan of their heads beats a heap
+    for (size_t i = 0; i < merge->count; i++) {
+        if (merge->positions[i] < snapshot_getLength(&merge->inputs[i])) {
+            const char *word = snapshot_word(&merge->inputs[i], merge->positions[i], NULL);
+            if (smallest == NULL || strcmp(word, smallest) < 0) {
+                smallest = word;
+            }
+        }
+    }
+    if (smallest == NULL) {
+        return false;
+    }
+
+    entry->word = smallest;
+    entry->length = strlen(smallest);
+    entry->count = 0;
+    for (size_t i = 0; i < merge->count; i++) {
+        const snapshot *input = &merge->inputs[i];
+        if (merge->positions[i] < snapshot_getLength(input) &&
+            strcmp(snapshot_word(input, merge->positions[i], NULL), smallest) == 0) {
+            entry->count += input->counts[merge->positions[i]++];
+        }
+    }
+    return true;
+}
+
+static void rewindMerge(void *context) {
+    MergeSource *merge = (MergeSource *)context;
+    memset(merge->positions, 0, merge->count * sizeof(size_t));
+}
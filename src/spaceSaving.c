@@ -0,0 +1,429 @@
+/*
+ * Most Frequent Words - Space-Saving heavy hitters summary
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "spaceSaving_cfg.h"
+#include "spaceSaving.h"
+#include "hashFunctions.h"
+
+typedef struct ssCounter ssCounter;
+
+// Stream-summary bucket: every counter with the same count
+typedef struct ssBucket {
+    uint64_t count;             // count shared by the counters of the bucket
+    struct ssBucket *smaller;   // bucket with the next smaller count
+    struct ssBucket *larger;    // bucket with the next larger count, or next free bucket
+    ssCounter *counters;        // doubly linked list of the counters
+} ssBucket;
+
+// A monitored word
+struct ssCounter {
+    char *word;                 // null-terminated copy of the word
+    size_t length;              // bytes in word
+    size_t wordCapacity;        // allocated size of word
+    uint64_t hash;              // hash of the word, reused by the index
+    uint64_t error;             // maximum overestimation of the bucket count
+    ssBucket *bucket;           // bucket holding the counter
+    ssCounter *prev;            // neighbours in the bucket list
+    ssCounter *next;
+};
+
+struct spaceSaving {
+    ssCounter *counters;        // capacity counters, the first used are in use
+    size_t capacity;            // number of counters
+    size_t used;                // counters holding a word
+    ssBucket *buckets;          // capacity + 1 buckets, one spare while moving a counter
+    ssBucket *freeBuckets;      // unused buckets, linked through larger
+    ssBucket *minBucket;        // bucket with the smallest count
+    ssBucket *maxBucket;        // bucket with the largest count
+    uint32_t *index;            // word -> counter index + 1, 0 marks an empty slot
+    unsigned int indexBits;     // log2 of the number of index slots
+    uint64_t *sketch;           // SPACESAVING_SKETCH_DEPTH rows of sketchWidth cells, or NULL
+    size_t sketchWidth;         // cells per row, a power of two
+    uint64_t total;             // occurrences counted
+    uint64_t evictedMax;        // largest count of an evicted word
+};
+
+static uint64_t hashWord(const char *word, size_t length);
+static size_t indexSlot(const spaceSaving *summary, uint64_t hash);
+static ssCounter *findCounter(const spaceSaving *summary, const char *word, size_t length, uint64_t hash);
+static void indexInsert(spaceSaving *summary, ssCounter *counter);
+static void indexRemove(spaceSaving *summary, ssCounter *counter);
+static uint64_t sketchAdd(spaceSaving *summary, uint64_t hash);
+static void detachCounter(ssCounter *counter);
+static void attachCounter(spaceSaving *summary, ssCounter *counter, uint64_t count, ssBucket *start);
+static void releaseIfEmpty(spaceSaving *summary, ssBucket *bucket);
+static void incrementCounter(spaceSaving *summary, ssCounter *counter);
+static bool setWord(ssCounter *counter, const char *word, size_t length, uint64_t hash);
+static int cmpEstimate(const void *a, const void *b);
+
+spaceSaving *spaceSaving_create(const spaceSaving_config *config) {
+    size_t budget = (config != NULL && config->memory_budget > 0) ? config->memory_budget
+                                                                  : (size_t)SPACESAVING_DEFAULT_MEMORY_BUDGET;
+    bool useSketch = (config != NULL) && config->use_sketch;
+
+    spaceSaving *summary = (spaceSaving *)calloc(1, sizeof(spaceSaving));
+    if (summary == NULL) {
+        return NULL;
+    }
+
+    // The sketch takes its share first, as the largest power of two of cells that fits
+    if (useSketch) {
+        size_t rowBytes = budget / SPACESAVING_SKETCH_SHARE / SPACESAVING_SKETCH_DEPTH;
+        summary->sketchWidth = 1;
+        while (summary->sketchWidth * 2 * sizeof(uint64_t) <= rowBytes) {
+            summary->sketchWidth *= 2;
+        }
+        budget -= summary->sketchWidth * SPACESAVING_SKETCH_DEPTH * sizeof(uint64_t);
+    }
+
+    // Each counter costs its struct, a bucket, two index slots and its key
+    size_t perCounter = sizeof(ssCounter) + sizeof(ssBucket) + 2 * sizeof(uint32_t) +
+                        SPACESAVING_KEY_BYTES_ESTIMATE;
+    size_t capacity = budget / perCounter;
+    if (capacity == 0) {
+        capacity = 1;
+    }
+    if (capacity > UINT32_MAX / 4) {
+        capacity = UINT32_MAX / 4;
+    }
+    summary->capacity = capacity;
+
+    // At most half of the index slots are used, so probes stay short
+    summary->indexBits = 1;
+    while (((size_t)1 << summary->indexBits) < 2 * capacity) {
+        summary->indexBits++;
+    }
+
+    summary->counters = (ssCounter *)calloc(capacity, sizeof(ssCounter));
+    summary->buckets = (ssBucket *)calloc(capacity + 1, sizeof(ssBucket));
+    summary->index = (uint32_t *)calloc((size_t)1 << summary->indexBits, sizeof(uint32_t));
+    if (useSketch) {
+        summary->sketch = (uint64_t *)calloc(summary->sketchWidth * SPACESAVING_SKETCH_DEPTH,
+                                             sizeof(uint64_t));
+    }
+    if (summary->counters == NULL || summary->buckets == NULL || summary->index == NULL ||
+        (useSketch && summary->sketch == NULL)) {
+        spaceSaving_destroy(summary);
+        return NULL;
+    }
+
+    for (size_t i = 0; i <= capacity; i++) {
+        summary->buckets[i].larger = (i < capacity) ? &summary->buckets[i + 1] : NULL;
+    }
+    summary->freeBuckets = &summary->buckets[0];
+    return summary;
+}
+
+void spaceSaving_destroy(spaceSaving *summary) {
+    if (summary == NULL) {
+        return;
+    }
+    if (summary->counters != NULL) {
+        for (size_t i = 0; i < summary->used; i++) {
+            free(summary->counters[i].word);
+        }
+    }
+    free(summary->counters);
+    free(summary->buckets);
+    free(summary->index);
+    free(summary->sketch);
+    free(summary);
+}
+
+bool spaceSaving_add(spaceSaving *summary, const char *word, size_t length) {
+    uint64_t hash = hashWord(word, length);
+    // Every occurrence goes into the sketch, its estimates stay upper bounds
+    uint64_t estimate = (summary->sketch != NULL) ? sketchAdd(summary, hash) : UINT64_MAX;
+
+    ssCounter *counter = findCounter(summary, word, length, hash);
+    if (counter != NULL) {
+        incrementCounter(summary, counter);
+        summary->total++;
+        return true;
+    }
+
+    if (summary->used < summary->capacity) {
+        // Nothing was evicted yet, so this is the word's first occurrence
+        counter = &summary->counters[summary->used];
+        if (!setWord(counter, word, length, hash)) {
+            return false;
+        }
+        summary->used++;
+        counter->error = 0;
+        indexInsert(summary, counter);
+        attachCounter(summary, counter, 1, NULL);
+        summary->total++;
+        return true;
+    }
+
+    // Replace a word with the smallest count
+    ssBucket *minBucket = summary->minBucket;
+    counter = minBucket->counters;
+    indexRemove(summary, counter);
+    if (!setWord(counter, word, length, hash)) {
+        indexInsert(summary, counter); // The old word is left untouched
+        return false;
+    }
+    if (minBucket->count > summary->evictedMax) {
+        summary->evictedMax = minBucket->count;
+    }
+
+    // An unmonitored word occurred at most evictedMax times before (classic
+    // Space-Saving: min + 1), and at most its sketch estimate times
+    uint64_t count = summary->evictedMax + 1;
+    if (estimate < count) {
+        count = estimate;
+    }
+
+    detachCounter(counter);
+    counter->error = count - 1;
+    attachCounter(summary, counter, count, NULL);
+    releaseIfEmpty(summary, minBucket);
+    indexInsert(summary, counter);
+    summary->total++;
+    return true;
+}
+
+bool spaceSaving_top(spaceSaving *summary, size_t n, spaceSaving_estimate *result, size_t *selected) {
+    *selected = 0;
+    if (n == 0 || summary->used == 0) {
+        return true;
+    }
+
+    // Whole buckets from the largest count down, so ties at the cut are all present
+    spaceSaving_estimate *candidates =
+        (spaceSaving_estimate *)malloc(summary->used * sizeof(spaceSaving_estimate));
+    if (candidates == NULL) {
+        return false;
+    }
+    size_t count = 0;
+    for (ssBucket *bucket = summary->maxBucket; bucket != NULL && count < n; bucket = bucket->smaller) {
+        for (ssCounter *counter = bucket->counters; counter != NULL; counter = counter->next) {
+            candidates[count].word = counter->word;
+            candidates[count].count = bucket->count;
+            candidates[count].error = counter->error;
+            count++;
+        }
+    }
+
+    qsort(candidates, count, sizeof(spaceSaving_estimate), cmpEstimate);
+    if (count > n) {
+        count = n;
+    }
+    memcpy(result, candidates, count * sizeof(spaceSaving_estimate));
+    free(candidates);
+    *selected = count;
+    return true;
+}
+
+size_t spaceSaving_getCapacity(const spaceSaving *summary) {
+    return summary->capacity;
+}
+
+uint64_t spaceSaving_getTotal(const spaceSaving *summary) {
+    return summary->total;
+}
+
+// Unseeded, so summaries of the same stream are identical across runs
+static uint64_t hashWord(const char *word, size_t length) {
+    return hashFunctions_wyhash(word, length, 0);
+}
+
+// Fibonacci hashing onto the index slots
+static size_t indexSlot(const spaceSaving *summary, uint64_t hash) {
+    return (size_t)((hash * UINT64_C(0x9E3779B97F4A7C15)) >> (64u - summary->indexBits));
+}
+
+static ssCounter *findCounter(const spaceSaving *summary, const char *word, size_t length, uint64_t hash) {
+    size_t mask = ((size_t)1 << summary->indexBits) - 1;
+    for (size_t slot = indexSlot(summary, hash); summary->index[slot] != 0; slot = (slot + 1) & mask) {
+        ssCounter *counter = &summary->counters[summary->index[slot] - 1];
+        if (counter->hash == hash && counter->length == length &&
+            memcmp(counter->word, word, length) == 0) {
+            return counter;
+        }
+    }
+    return NULL;
+}
+
+static void indexInsert(spaceSaving *summary, ssCounter *counter) {
+    size_t mask = ((size_t)1 << summary->indexBits) - 1;
+    size_t slot = indexSlot(summary, counter->hash);
+    while (summary->index[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    summary->index[slot] = (uint32_t)(counter - summary->counters) + 1;
+}
+
+// Backward-shift deletion, keeps every probe sequence unbroken without tombstones
+static void indexRemove(spaceSaving *summary, ssCounter *counter) {
+    size_t mask = ((size_t)1 << summary->indexBits) - 1;
+    uint32_t id = (uint32_t)(counter - summary->counters) + 1;
+    size_t hole = indexSlot(summary, counter->hash);
+    while (summary->index[hole] != id) {
+        hole = (hole + 1) & mask;
+    }
+
+    for (size_t slot = (hole + 1) & mask; summary->index[slot] != 0; slot = (slot + 1) & mask) {
+        size_t home = indexSlot(summary, summary->counters[summary->index[slot] - 1].hash);
+        // Move the entry back unless its home lies between the hole and its slot
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            summary->index[hole] = summary->index[slot];
+            hole = slot;
+        }
+    }
+    summary->index[hole] = 0;
+}
+
+// Conservative update: only the smallest cells grow, returns the new estimate
+static uint64_t sketchAdd(spaceSaving *summary, uint64_t hash) {
+    // splitmix64 finalizer, then double hashing for the rows
+    uint64_t mixed = hash;
+    mixed = (mixed ^ (mixed >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    mixed = (mixed ^ (mixed >> 27)) * UINT64_C(0x94d049bb133111eb);
+    mixed ^= mixed >> 31;
+    size_t step = (size_t)(mixed >> 32) | 1u;
+    size_t mask = summary->sketchWidth - 1;
+    uint64_t *cells[SPACESAVING_SKETCH_DEPTH];
+    uint64_t estimate = UINT64_MAX;
+
+    for (size_t row = 0; row < SPACESAVING_SKETCH_DEPTH; row++) {
+        size_t column = ((size_t)mixed + row * step) & mask;
+        cells[row] = &summary->sketch[row * summary->sketchWidth + column];
+        if (*cells[row] < estimate) {
+            estimate = *cells[row];
+        }
+    }
+    estimate++;
+    for (size_t row = 0; row < SPACESAVING_SKETCH_DEPTH; row++) {
+        if (*cells[row] < estimate) {
+            *cells[row] = estimate;
+        }
+    }
+    return estimate;
+}
+
+// Unlink a counter from its bucket list, the bucket is kept even if empty
+static void detachCounter(ssCounter *counter) {
+    ssBucket *bucket = counter->bucket;
+    if (counter->prev != NULL) {
+        counter->prev->next = counter->next;
+    } else {
+        bucket->counters = counter->next;
+    }
+    if (counter->next != NULL) {
+        counter->next->prev = counter->prev;
+    }
+    counter->prev = NULL;
+    counter->next = NULL;
+    counter->bucket = NULL;
+}
+
+// Add a counter to the bucket of count, searching upward from start (or the minimum)
+static void attachCounter(spaceSaving *summary, ssCounter *counter, uint64_t count, ssBucket *start) {
+    ssBucket *below = (start != NULL) ? start->smaller : NULL;
+    ssBucket *bucket = (start != NULL) ? start : summary->minBucket;
+    while (bucket != NULL && bucket->count < count) {
+        below = bucket;
+        bucket = bucket->larger;
+    }
+
+    if (bucket == NULL || bucket->count != count) {
+        // No bucket for this count yet, link a free one between below and bucket
+        ssBucket *created = summary->freeBuckets;
+        summary->freeBuckets = created->larger;
+        created->count = count;
+        created->counters = NULL;
+        created->smaller = below;
+        created->larger = bucket;
+        if (below != NULL) {
+            below->larger = created;
+        } else {
+            summary->minBucket = created;
+        }
+        if (bucket != NULL) {
+            bucket->smaller = created;
+        } else {
+            summary->maxBucket = created;
+        }
+        bucket = created;
+    }
+
+    counter->bucket = bucket;
+    counter->prev = NULL;
+    counter->next = bucket->counters;
+    if (bucket->counters != NULL) {
+        bucket->counters->prev = counter;
+    }
+    bucket->counters = counter;
+}
+
+static void releaseIfEmpty(spaceSaving *summary, ssBucket *bucket) {
+    if (bucket->counters != NULL) {
+        return;
+    }
+    if (bucket->smaller != NULL) {
+        bucket->smaller->larger = bucket->larger;
+    } else {
+        summary->minBucket = bucket->larger;
+    }
+    if (bucket->larger != NULL) {
+        bucket->larger->smaller = bucket->smaller;
+    } else {
+        summary->maxBucket = bucket->smaller;
+    }
+    bucket->larger = summary->freeBuckets;
+    summary->freeBuckets = bucket;
+}
+
+static void incrementCounter(spaceSaving *summary, ssCounter *counter) {
+    ssBucket *bucket = counter->bucket;
+    uint64_t count = bucket->count + 1;
+
+    // Alone in its bucket and no bucket for count + 1: bump the bucket itself
+    if (bucket->counters == counter && counter->next == NULL &&
+        (bucket->larger == NULL || bucket->larger->count != count)) {
+        bucket->count = count;
+        return;
+    }
+
+    detachCounter(counter);
+    attachCounter(summary, counter, count, bucket);
+    releaseIfEmpty(summary, bucket);
+}
+
+static bool setWord(ssCounter *counter, const char *word, size_t length, uint64_t hash) {
+    if (length + 1 > counter->wordCapacity) {
+        char *grown = (char *)realloc(counter->word, length + 1);
+        if (grown == NULL) {
+            return false;
+        }
+        counter->word = grown;
+        counter->wordCapacity = length + 1;
+    }
+    memcpy(counter->word, word, length);
+    counter->word[length] = '\0';
+    counter->length = length;
+    counter->hash = hash;
+    return true;
+}
+
+// Count descending, then word ascending, like the exact ranking
+static int cmpEstimate(const void *a, const void *b) {
+    const spaceSaving_estimate *estA = (const spaceSaving_estimate *)a;
+    const spaceSaving_estimate *estB = (const spaceSaving_estimate *)b;
+
+    if (estA->count != estB->count) {
+        return (estA->count > estB->count) ? -1 : 1;
+    }
+    return strcmp(estA->word, estB->word);
+}
@@ -0,0 +1,119 @@
+/*
+ * Most Frequent Words - Compile-time instrumentation
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "stats.h"
+
+static const char *const phaseNames[STATS_PHASES] = { "scan", "merge", "snapshot", "dump", "select", "copy" };
+
+// Counters bumped from many threads use relaxed atomics, tables are folded under the lock
+static uint64_t phaseNanoseconds[STATS_PHASES];
+static uint64_t phaseCalls[STATS_PHASES];
+static uint64_t allocations;
+static uint64_t allocatedBytes;
+static uint64_t tables;
+static hashTable_stats tableTotals;
+static hashTable_stats largestTable;
+static pthread_mutex_t tableLock = PTHREAD_MUTEX_INITIALIZER;
+
+double stats_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+void stats_addPhase(stats_phase phase, double start) {
+    double elapsed = stats_now() - start;
+    __atomic_fetch_add(&phaseNanoseconds[phase], (uint64_t)(elapsed * 1e9), __ATOMIC_RELAXED);
+    __atomic_fetch_add(&phaseCalls[phase], 1, __ATOMIC_RELAXED);
+}
+
+void stats_countAllocation(uint64_t bytes) {
+    __atomic_fetch_add(&allocations, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&allocatedBytes, bytes, __ATOMIC_RELAXED);
+}
+
+void stats_addTable(const hashTable_stats *table) {
+    pthread_mutex_lock(&tableLock);
+    tables++;
+    tableTotals.lookups += table->lookups;
+    tableTotals.hits += table->hits;
+    tableTotals.inserts += table->inserts;
+    tableTotals.deletes += table->deletes;
+    tableTotals.probes += table->probes;
+    tableTotals.comparisons += table->comparisons;
+    tableTotals.resizes += table->resizes;
+    if (table->length >= largestTable.length) {
+        largestTable = *table;
+    }
+    pthread_mutex_unlock(&tableLock);
+}
+
+void stats_get(stats_report *report) {
+    memset(report, 0, sizeof(stats_report));
+    for (int p = 0; p < STATS_PHASES; p++) {
+        report->phase_s[p] = (double)__atomic_load_n(&phaseNanoseconds[p], __ATOMIC_RELAXED) * 1e-9;
+        report->phase_calls[p] = __atomic_load_n(&phaseCalls[p], __ATOMIC_RELAXED);
+    }
+    report->allocations = __atomic_load_n(&allocations, __ATOMIC_RELAXED);
+    report->allocated_bytes = __atomic_load_n(&allocatedBytes, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&tableLock);
+    report->tables = tables;
+    report->table_totals = tableTotals;
+    report->largest_table = largestTable;
+    pthread_mutex_unlock(&tableLock);
+}
+
+void stats_reset(void) {
+    for (int p = 0; p < STATS_PHASES; p++) {
+        __atomic_store_n(&phaseNanoseconds[p], 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&phaseCalls[p], 0, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&allocations, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&allocatedBytes, 0, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&tableLock);
+    tables = 0;
+    memset(&tableTotals, 0, sizeof(tableTotals));
+    memset(&largestTable, 0, sizeof(largestTable));
+    pthread_mutex_unlock(&tableLock);
+}
+
+void stats_dump(FILE *out) {
+    if (!STATS_ENABLED) {
+        fprintf(out, "stats: not compiled in, rebuild with make clean stats-build\n");
+        return;
+    }
+
+    stats_report report;
+    stats_get(&report);
+    for (int p = 0; p < STATS_PHASES; p++) {
+        fprintf(out, "stats: phase %-8s %10.3f s (%llu runs)\n", phaseNames[p], report.phase_s[p],
+                (unsigned long long)report.phase_calls[p]);
+    }
+    fprintf(out, "stats: allocations %llu (%.1f MiB)\n", (unsigned long long)report.allocations,
+            (double)report.allocated_bytes / (1024.0 * 1024.0));
+
+    const hashTable_stats *totals = &report.table_totals;
+    double lookups = (totals->lookups > 0) ? (double)totals->lookups : 1.0;
+    fprintf(out, "stats: tables %llu, lookups %llu (%llu hits), inserts %llu, deletes %llu, resizes %llu\n",
+            (unsigned long long)report.tables, (unsigned long long)totals->lookups,
+            (unsigned long long)totals->hits, (unsigned long long)totals->inserts,
+            (unsigned long long)totals->deletes, (unsigned long long)totals->resizes);
+    fprintf(out, "stats: per lookup %.3f slots probed, %.3f key compares\n",
+            (double)totals->probes / lookups, (double)totals->comparisons / lookups);
+
+    const hashTable_stats *largest = &report.largest_table;
+    fprintf(out, "stats: largest table %zu keys in %zu slots (load %.3f), probe length mean %.3f max %zu\n",
+            largest->length, largest->capacity, largest->load_factor, largest->mean_probe_length,
+            largest->max_probe_length);
+}
@@ -0,0 +1,209 @@
+/*
+ * Most Frequent Words - Built-in stopword table
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ *
+ * Generated by tools/stopwordTableGen.py from cfg/stopwords.txt, do not edit.
+ * 178 words in 178 slots, 45 buckets, 4452 bytes in all.
+ */
+
+#include <stdint.h>
+
+#include "stopwords.h"
+
+// Fails to compile if the generator and the header disagree on the key size
+typedef char stopwordTable_maxLengthMatches[(STOPWORDS_MAX_LENGTH == 16) ? 1 : -1];
+
+static const stopwords_key stopwordTable_keys[178] = {
+    { UINT64_C(0x6572657765726577), UINT64_C(0x6572657765726577),  4 }, // were
+    { UINT64_C(0x000000000069736e), UINT64_C(0x0000000000000000),  3 }, // isn
+    { UINT64_C(0x0000000000736f6f), UINT64_C(0x0000000000000000),  2 }, // so
+    { UINT64_C(0x7972657679726576), UINT64_C(0x7972657679726576),  4 }, // very
+    { UINT64_C(0x00000000006f6f6f), UINT64_C(0x0000000000000000),  1 }, // o
+    { UINT64_C(0x736f6874736f6874), UINT64_C(0x65736f6865736f68),  5 }, // those
+    { UINT64_C(0x6863616568636165), UINT64_C(0x6863616568636165),  4 }, // each
+    { UINT64_C(0x6572657765726577), UINT64_C(0x746e6572746e6572),  6 }, // werent
+    { UINT64_C(0x0000000000747474), UINT64_C(0x0000000000000000),  1 }, // t
+    { UINT64_C(0x73656f6473656f64), UINT64_C(0x746e7365746e7365),  6 }, // doesnt
+    { UINT64_C(0x6e7361686e736168), UINT64_C(0x746e7361746e7361),  5 }, // hasnt
+    { UINT64_C(0x756f6873756f6873), UINT64_C(0x646c756f646c756f),  6 }, // should
+    { UINT64_C(0x6e6469646e646964), UINT64_C(0x6e6469646e646964),  4 }, // didn
+    { UINT64_C(0x7365687473656874), UINT64_C(0x6573656865736568),  5 }, // these
+    { UINT64_C(0x6e6168746e616874), UINT64_C(0x6e6168746e616874),  4 }, // than
+    { UINT64_C(0x7774656277746562), UINT64_C(0x6e6565776e656577),  7 }, // between
+    { UINT64_C(0x6c756f776c756f77), UINT64_C(0x746e646c746e646c),  7 }, // wouldnt
+    { UINT64_C(0x0000000000616d6d), UINT64_C(0x0000000000000000),  2 }, // am
+    { UINT64_C(0x00000000006d6161), UINT64_C(0x0000000000000000),  2 }, // ma
+    { UINT64_C(0x65726f6d65726f6d), UINT64_C(0x65726f6d65726f6d),  4 }, // more
+    { UINT64_C(0x736d6968736d6968), UINT64_C(0x666c6573666c6573),  7 }, // himself
+    { UINT64_C(0x6576616865766168), UINT64_C(0x6e6576616e657661),  5 }, // haven
+    { UINT64_C(0x00000000006c6c6c), UINT64_C(0x0000000000000000),  2 }, // ll
+    { UINT64_C(0x00000000006f776e), UINT64_C(0x0000000000000000),  3 }, // own
+    { UINT64_C(0x73656f6473656f64), UINT64_C(0x73656f6473656f64),  4 }, // does
+    { UINT64_C(0x0000000000697474), UINT64_C(0x0000000000000000),  2 }, // it
+    { UINT64_C(0x0000000000617373), UINT64_C(0x0000000000000000),  2 }, // as
+    { UINT64_C(0x0000000000746f6f), UINT64_C(0x0000000000000000),  3 }, // too
+    { UINT64_C(0x7372656873726568), UINT64_C(0x7372656873726568),  4 }, // hers
+    { UINT64_C(0x0000000000616161), UINT64_C(0x0000000000000000),  1 }, // a
+    { UINT64_C(0x0000000000686164), UINT64_C(0x0000000000000000),  3 }, // had
+    { UINT64_C(0x0000000000666577), UINT64_C(0x0000000000000000),  3 }, // few
+    { UINT64_C(0x6574666165746661), UINT64_C(0x7265746672657466),  5 }, // after
+    { UINT64_C(0x6f6c65626f6c6562), UINT64_C(0x776f6c65776f6c65),  5 }, // below
+    { UINT64_C(0x6965687469656874), UINT64_C(0x7372696573726965),  6 }, // theirs
+    { UINT64_C(0x7472756674727566), UINT64_C(0x7265687472656874),  7 }, // further
+    { UINT64_C(0x0000000000616e79), UINT64_C(0x0000000000000000),  3 }, // any
+    { UINT64_C(0x0000000000697373), UINT64_C(0x0000000000000000),  2 }, // is
+    { UINT64_C(0x0000000000776565), UINT64_C(0x0000000000000000),  2 }, // we
+    { UINT64_C(0x000000000061696e), UINT64_C(0x0000000000000000),  3 }, // ain
+    { UINT64_C(0x6e6572616e657261), UINT64_C(0x746e6572746e6572),  5 }, // arent
+    { UINT64_C(0x6e7361776e736177), UINT64_C(0x6e7361776e736177),  4 }, // wasn
+    { UINT64_C(0x6e6572616e657261), UINT64_C(0x6e6572616e657261),  4 }, // aren
+    { UINT64_C(0x6874697768746977), UINT64_C(0x6874697768746977),  4 }, // with
+    { UINT64_C(0x6e6469646e646964), UINT64_C(0x746e6469746e6469),  5 }, // didnt
+    { UINT64_C(0x7372756f65766c65), UINT64_C(0x7365766c65737275),  9 }, // ourselves
+    { UINT64_C(0x756f6261756f6261), UINT64_C(0x74756f6274756f62),  5 }, // about
+    { UINT64_C(0x0000000000646f6f), UINT64_C(0x0000000000000000),  2 }, // do
+    { UINT64_C(0x6465656e6465656e), UINT64_C(0x6e6465656e646565),  5 }, // needn
+    { UINT64_C(0x0000000000746f6f), UINT64_C(0x0000000000000000),  2 }, // to
+    { UINT64_C(0x6e696f646e696f64), UINT64_C(0x676e696f676e696f),  5 }, // doing
+    { UINT64_C(0x00000000006f6666), UINT64_C(0x0000000000000000),  2 }, // of
+    { UINT64_C(0x6e6965626e696562), UINT64_C(0x676e6965676e6965),  5 }, // being
+    { UINT64_C(0x76756f7976756f79), UINT64_C(0x6576756f6576756f),  5 }, // youve
+    { UINT64_C(0x0000000000737373), UINT64_C(0x0000000000000000),  1 }, // s
+    { UINT64_C(0x6465656e6465656e), UINT64_C(0x746e6465746e6465),  6 }, // neednt
+    { UINT64_C(0x0000000000686f77), UINT64_C(0x0000000000000000),  3 }, // how
+    { UINT64_C(0x00000000006f7572), UINT64_C(0x0000000000000000),  3 }, // our
+    { UINT64_C(0x656d6173656d6173), UINT64_C(0x656d6173656d6173),  4 }, // same
+    { UINT64_C(0x0000000000616e6e), UINT64_C(0x0000000000000000),  2 }, // an
+    { UINT64_C(0x0000000000626565), UINT64_C(0x0000000000000000),  2 }, // be
+    { UINT64_C(0x6e6565626e656562), UINT64_C(0x6e6565626e656562),  4 }, // been
+    { UINT64_C(0x6e6168736e616873), UINT64_C(0x6e6168736e616873),  4 }, // shan
+    { UINT64_C(0x00000000006d6d6d), UINT64_C(0x0000000000000000),  1 }, // m
+    { UINT64_C(0x0000000000646964), UINT64_C(0x0000000000000000),  3 }, // did
+    { UINT64_C(0x746e6f77746e6f77), UINT64_C(0x746e6f77746e6f77),  4 }, // wont
+    { UINT64_C(0x00000000006f7272), UINT64_C(0x0000000000000000),  2 }, // or
+    { UINT64_C(0x00000000006f6666), UINT64_C(0x0000000000000000),  3 }, // off
+    { UINT64_C(0x7372656873726568), UINT64_C(0x666c6573666c6573),  7 }, // herself
+    { UINT64_C(0x6c756f776c756f77), UINT64_C(0x6e646c756e646c75),  6 }, // wouldn
+    { UINT64_C(0x0000000000776f6e), UINT64_C(0x0000000000000000),  3 }, // won
+    { UINT64_C(0x0000000000666f72), UINT64_C(0x0000000000000000),  3 }, // for
+    { UINT64_C(0x7461687474616874), UINT64_C(0x7461687474616874),  4 }, // that
+    { UINT64_C(0x6d656874766c6573), UINT64_C(0x7365766c65736d65), 10 }, // themselves
+    { UINT64_C(0x6e7361776e736177), UINT64_C(0x746e7361746e7361),  5 }, // wasnt
+    { UINT64_C(0x7265687772656877), UINT64_C(0x6572656865726568),  5 }, // where
+    { UINT64_C(0x0000000000616e64), UINT64_C(0x0000000000000000),  3 }, // and
+    { UINT64_C(0x6369687763696877), UINT64_C(0x6863696868636968),  5 }, // which
+    { UINT64_C(0x0000000000766565), UINT64_C(0x0000000000000000),  2 }, // ve
+    { UINT64_C(0x0000000000736865), UINT64_C(0x0000000000000000),  3 }, // she
+    { UINT64_C(0x6c6c69776c6c6977), UINT64_C(0x6c6c69776c6c6977),  4 }, // will
+    { UINT64_C(0x6e6568776e656877), UINT64_C(0x6e6568776e656877),  4 }, // when
+    { UINT64_C(0x0000000000696e6e), UINT64_C(0x0000000000000000),  2 }, // in
+    { UINT64_C(0x73656f6473656f64), UINT64_C(0x6e73656f6e73656f),  5 }, // doesn
+    { UINT64_C(0x756f6873746e646c), UINT64_C(0x746e646c756f6873),  8 }, // shouldnt
+    { UINT64_C(0x6e776f646e776f64), UINT64_C(0x6e776f646e776f64),  4 }, // down
+    { UINT64_C(0x0000000000746865), UINT64_C(0x0000000000000000),  3 }, // the
+    { UINT64_C(0x7265766f7265766f), UINT64_C(0x7265766f7265766f),  4 }, // over
+    { UINT64_C(0x6c6968776c696877), UINT64_C(0x656c6968656c6968),  5 }, // while
+    { UINT64_C(0x0000000000686173), UINT64_C(0x0000000000000000),  3 }, // has
+    { UINT64_C(0x00000000006e6f72), UINT64_C(0x0000000000000000),  3 }, // nor
+    { UINT64_C(0x7372756f7372756f), UINT64_C(0x7372756f7372756f),  4 }, // ours
+    { UINT64_C(0x756f68736576646c), UINT64_C(0x6576646c756f6873),  8 }, // shouldve
+    { UINT64_C(0x6976616869766168), UINT64_C(0x676e6976676e6976),  6 }, // having
+    { UINT64_C(0x6e6168736e616873), UINT64_C(0x746e6168746e6168),  5 }, // shant
+    { UINT64_C(0x00000000006f7574), UINT64_C(0x0000000000000000),  3 }, // out
+    { UINT64_C(0x0000000000617474), UINT64_C(0x0000000000000000),  2 }, // at
+    { UINT64_C(0x6572657765726577), UINT64_C(0x6e6572656e657265),  5 }, // weren
+    { UINT64_C(0x6f6665626f666562), UINT64_C(0x65726f6665726f66),  6 }, // before
+    { UINT64_C(0x746e6f64746e6f64), UINT64_C(0x746e6f64746e6f64),  4 }, // dont
+    { UINT64_C(0x7473756d7473756d), UINT64_C(0x746e7473746e7473),  6 }, // mustnt
+    { UINT64_C(0x6576616865766168), UINT64_C(0x6576616865766168),  4 }, // have
+    { UINT64_C(0x00000000006d7979), UINT64_C(0x0000000000000000),  2 }, // my
+    { UINT64_C(0x6e6568746e656874), UINT64_C(0x6e6568746e656874),  4 }, // then
+    { UINT64_C(0x64756f7964756f79), UINT64_C(0x64756f7964756f79),  4 }, // youd
+    { UINT64_C(0x7265687472656874), UINT64_C(0x6572656865726568),  5 }, // there
+    { UINT64_C(0x6867696d6867696d), UINT64_C(0x746e7468746e7468),  7 }, // mightnt
+    { UINT64_C(0x6573796d6573796d), UINT64_C(0x666c6573666c6573),  6 }, // myself
+    { UINT64_C(0x0000000000776173), UINT64_C(0x0000000000000000),  3 }, // was
+    { UINT64_C(0x68746f6268746f62), UINT64_C(0x68746f6268746f62),  4 }, // both
+    { UINT64_C(0x69746e7569746e75), UINT64_C(0x6c69746e6c69746e),  5 }, // until
+    { UINT64_C(0x0000000000686973), UINT64_C(0x0000000000000000),  3 }, // his
+    { UINT64_C(0x000000000063616e), UINT64_C(0x0000000000000000),  3 }, // can
+    { UINT64_C(0x0000000000697473), UINT64_C(0x0000000000000000),  3 }, // its
+    { UINT64_C(0x0000000000616c6c), UINT64_C(0x0000000000000000),  3 }, // all
+    { UINT64_C(0x6e7361686e736168), UINT64_C(0x6e7361686e736168),  4 }, // hasn
+    { UINT64_C(0x0000000000696666), UINT64_C(0x0000000000000000),  2 }, // if
+    { UINT64_C(0x6576616865766168), UINT64_C(0x746e6576746e6576),  6 }, // havent
+    { UINT64_C(0x7965687479656874), UINT64_C(0x7965687479656874),  4 }, // they
+    { UINT64_C(0x00000000006f6e6e), UINT64_C(0x0000000000000000),  2 }, // on
+    { UINT64_C(0x0000000000757070), UINT64_C(0x0000000000000000),  2 }, // up
+    { UINT64_C(0x0000000000646464), UINT64_C(0x0000000000000000),  1 }, // d
+    { UINT64_C(0x0000000000617265), UINT64_C(0x0000000000000000),  3 }, // are
+    { UINT64_C(0x766f6261766f6261), UINT64_C(0x65766f6265766f62),  5 }, // above
+    { UINT64_C(0x00000000006e6f77), UINT64_C(0x0000000000000000),  3 }, // now
+    { UINT64_C(0x6568746f6568746f), UINT64_C(0x7265687472656874),  5 }, // other
+    { UINT64_C(0x0000000000796f75), UINT64_C(0x0000000000000000),  3 }, // you
+    { UINT64_C(0x6c756f636c756f63), UINT64_C(0x6e646c756e646c75),  6 }, // couldn
+    { UINT64_C(0x6d6f68776d6f6877), UINT64_C(0x6d6f68776d6f6877),  4 }, // whom
+    { UINT64_C(0x6e6461686e646168), UINT64_C(0x6e6461686e646168),  4 }, // hadn
+    { UINT64_C(0x746e7369746e7369), UINT64_C(0x746e7369746e7369),  4 }, // isnt
+    { UINT64_C(0x0000000000686565), UINT64_C(0x0000000000000000),  2 }, // he
+    { UINT64_C(0x756f6873756f6873), UINT64_C(0x6e646c756e646c75),  7 }, // shouldn
+    { UINT64_C(0x00000000006e6f74), UINT64_C(0x0000000000000000),  3 }, // not
+    { UINT64_C(0x00000000006d6565), UINT64_C(0x0000000000000000),  2 }, // me
+    { UINT64_C(0x72756f79766c6573), UINT64_C(0x7365766c65737275), 10 }, // yourselves
+    { UINT64_C(0x6d6568746d656874), UINT64_C(0x6d6568746d656874),  4 }, // them
+    { UINT64_C(0x6867696d6867696d), UINT64_C(0x6e7468676e746867),  6 }, // mightn
+    { UINT64_C(0x6f7268746f726874), UINT64_C(0x6867756f6867756f),  7 }, // through
+    { UINT64_C(0x72756f7972756f79), UINT64_C(0x6572756f6572756f),  5 }, // youre
+    { UINT64_C(0x000000000077686f), UINT64_C(0x0000000000000000),  3 }, // who
+    { UINT64_C(0x00000000006e6f6f), UINT64_C(0x0000000000000000),  2 }, // no
+    { UINT64_C(0x65636e6f65636e6f), UINT64_C(0x65636e6f65636e6f),  4 }, // once
+    { UINT64_C(0x0000000000726565), UINT64_C(0x0000000000000000),  2 }, // re
+    { UINT64_C(0x65646e7565646e75), UINT64_C(0x7265646e7265646e),  5 }, // under
+    { UINT64_C(0x6972756469727564), UINT64_C(0x676e6972676e6972),  6 }, // during
+    { UINT64_C(0x6863757368637573), UINT64_C(0x6863757368637573),  4 }, // such
+    { UINT64_C(0x6573746965737469), UINT64_C(0x666c6573666c6573),  6 }, // itself
+    { UINT64_C(0x0000000000627574), UINT64_C(0x0000000000000000),  3 }, // but
+    { UINT64_C(0x0000000000627979), UINT64_C(0x0000000000000000),  2 }, // by
+    { UINT64_C(0x796c6e6f796c6e6f), UINT64_C(0x796c6e6f796c6e6f),  4 }, // only
+    { UINT64_C(0x7473756a7473756a), UINT64_C(0x7473756a7473756a),  4 }, // just
+    { UINT64_C(0x6e6461686e646168), UINT64_C(0x746e6461746e6461),  5 }, // hadnt
+    { UINT64_C(0x6961676169616761), UINT64_C(0x74736e6974736e69),  7 }, // against
+    { UINT64_C(0x6f746e696f746e69), UINT64_C(0x6f746e696f746e69),  4 }, // into
+    { UINT64_C(0x6572656865726568), UINT64_C(0x6572656865726568),  4 }, // here
+    { UINT64_C(0x6961676169616761), UINT64_C(0x6e6961676e696167),  5 }, // again
+    { UINT64_C(0x7369687473696874), UINT64_C(0x7369687473696874),  4 }, // this
+    { UINT64_C(0x000000000068696d), UINT64_C(0x0000000000000000),  3 }, // him
+    { UINT64_C(0x6965687469656874), UINT64_C(0x7269656872696568),  5 }, // their
+    { UINT64_C(0x0000000000646f6e), UINT64_C(0x0000000000000000),  3 }, // don
+    { UINT64_C(0x656d6f73656d6f73), UINT64_C(0x656d6f73656d6f73),  4 }, // some
+    { UINT64_C(0x6c756f796c756f79), UINT64_C(0x6c6c756f6c6c756f),  5 }, // youll
+    { UINT64_C(0x7461687474616874), UINT64_C(0x6c6c74616c6c7461),  6 }, // thatll
+    { UINT64_C(0x7461687774616877), UINT64_C(0x7461687774616877),  4 }, // what
+    { UINT64_C(0x6c756f636c756f63), UINT64_C(0x746e646c746e646c),  7 }, // couldnt
+    { UINT64_C(0x7473756d7473756d), UINT64_C(0x6e7473756e747375),  5 }, // mustn
+    { UINT64_C(0x0000000000797979), UINT64_C(0x0000000000000000),  1 }, // y
+    { UINT64_C(0x0000000000696969), UINT64_C(0x0000000000000000),  1 }, // i
+    { UINT64_C(0x0000000000776879), UINT64_C(0x0000000000000000),  3 }, // why
+    { UINT64_C(0x7365687373656873), UINT64_C(0x7365687373656873),  4 }, // shes
+    { UINT64_C(0x72756f79666c6573), UINT64_C(0x666c657372756f79),  8 }, // yourself
+    { UINT64_C(0x6d6f72666d6f7266), UINT64_C(0x6d6f72666d6f7266),  4 }, // from
+    { UINT64_C(0x6163656261636562), UINT64_C(0x6573756165737561),  7 }, // because
+    { UINT64_C(0x72756f7972756f79), UINT64_C(0x7372756f7372756f),  5 }, // yours
+    { UINT64_C(0x74736f6d74736f6d), UINT64_C(0x74736f6d74736f6d),  4 }, // most
+    { UINT64_C(0x72756f7972756f79), UINT64_C(0x72756f7972756f79),  4 }, // your
+    { UINT64_C(0x0000000000686572), UINT64_C(0x0000000000000000),  3 }, // her
+};
+
+static const uint32_t stopwordTable_displacements[45] = {
+         23,       0,       1,       5,       0,     146,     480,       3,
+        145,       6,      57,      19,     112,       0,      60,       3,
+          1,     528,       9,     659,       3,    1344,      15,      30,
+         12,      42,       0,    1561,     148,      32,     453,       0,
+        186,    1313,       0,       9,     154,      17,       0,      26,
+          1,    2907,    3637,     215,     134,
+};
+
+const stopwords stopwords_builtin = {
+    stopwordTable_keys, stopwordTable_displacements, 178, 45, UINT64_C(0x9e3779b97f4a7c15), 0x000007fe
+};
@@ -0,0 +1,217 @@
+/*
+ * Most Frequent Words - Stopword filter on a minimal perfect hash
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stopwords_cfg.h"
+#include "stopwords.h"
+#include "fileReader.h"
+#include "wordScanner.h"
+
+// Keys gathered from a list, before the hash is built
+typedef struct {
+    stopwords_key *keys;    // one per word, duplicates included
+    size_t count;           // keys in use
+    size_t capacity;        // keys allocated
+    bool tooLong;           // a word was longer than STOPWORDS_MAX_LENGTH
+} KeyList;
+
+// A bucket of the perfect hash and the words hashed to it
+typedef struct {
+    size_t bucket;          // index of the bucket
+    size_t first;           // first of its words in the bucket order
+    size_t size;            // words in the bucket
+} BucketRange;
+
+static bool addKey(const char *word, size_t length, void *context);
+static stopwords *buildFilter(stopwords_key *keys, size_t count);
+static bool placeWords(stopwords *filter, stopwords_key *slots, uint32_t *displacements,
+                       const stopwords_key *keys, uint64_t seed);
+static int compareKeys(const void *a, const void *b);
+static int compareRanges(const void *a, const void *b);
+
+stopwords *stopwords_load(const char *path) {
+    KeyList list = { NULL, 0, 0, false };
+    wordScanner scanner;
+    wordScanner_init(&scanner, addKey, &list);
+    bool ok = fileReader_scanFile(path, &scanner);
+    wordScanner_destroy(&scanner);
+
+    stopwords *filter = (ok && !list.tooLong) ? buildFilter(list.keys, list.count) : NULL;
+    free(list.keys);
+    return filter;
+}
+
+stopwords *stopwords_create(const char *const *words, size_t count) {
+    KeyList list = { NULL, 0, 0, false };
+    bool ok = true;
+    for (size_t i = 0; ok && i < count; i++) {
+        size_t length = strlen(words[i]);
+        ok = length > 0 && addKey(words[i], length, &list);
+    }
+    stopwords *filter = ok ? buildFilter(list.keys, list.count) : NULL;
+    free(list.keys);
+    return filter;
+}
+
+void stopwords_destroy(stopwords *filter) {
+    // Keys and displacements share the filter's allocation
+    free(filter);
+}
+
+static bool addKey(const char *word, size_t length, void *context) {
+    KeyList *list = (KeyList *)context;
+    if (length > STOPWORDS_MAX_LENGTH) {
+        list->tooLong = true;
+        return false;
+    }
+    if (list->count == list->capacity) {
+        size_t capacity = (list->capacity == 0) ? 64 : list->capacity * 2;
+        stopwords_key *grown = (stopwords_key *)realloc(list->keys, capacity * sizeof(stopwords_key));
+        if (grown == NULL) {
+            return false;
+        }
+        list->keys = grown;
+        list->capacity = capacity;
+    }
+    list->keys[list->count++] = stopwords_makeKey(word, length);
+    return true;
+}
+
+// Filter of the distinct keys, in one allocation with its slots and displacements
+static stopwords *buildFilter(stopwords_key *keys, size_t count) {
+    // Equal words have equal keys, sorting brings them together
+    size_t distinct = 0;
+    if (count > 0) {
+        qsort(keys, count, sizeof(stopwords_key), compareKeys);
+        distinct = 1;
+        for (size_t i = 1; i < count; i++) {
+            if (compareKeys(&keys[i], &keys[distinct - 1]) != 0) {
+                keys[distinct++] = keys[i];
+            }
+        }
+    }
+
+    size_t bucketCount = distinct / STOPWORDS_BUCKET_SIZE + 1;
+    stopwords *filter = (stopwords *)malloc(sizeof(stopwords) + distinct * sizeof(stopwords_key) +
+                                            bucketCount * sizeof(uint32_t));
+    if (filter == NULL) {
+        return NULL;
+    }
+    stopwords_key *slots = (stopwords_key *)(filter + 1);
+    uint32_t *displacements = (uint32_t *)(slots + distinct);
+    filter->keys = slots;
+    filter->displacements = displacements;
+    filter->count = distinct;
+    filter->bucket_count = bucketCount;
+    filter->lengths = 0;
+    for (size_t i = 0; i < distinct; i++) {
+        filter->lengths |= (uint32_t)1 << keys[i].length;
+    }
+
+    // A seed whose buckets cannot all be placed is replaced by the next one
+    for (uint64_t attempt = 1; attempt <= STOPWORDS_MAX_ATTEMPTS; attempt++) {
+        uint64_t seed = attempt * UINT64_C(0x9E3779B97F4A7C15);
+        if (placeWords(filter, slots, displacements, keys, seed)) {
+            filter->seed = seed;
+            return filter;
+        }
+    }
+    free(filter);
+    return NULL;
+}
+
+// Displacements of every bucket under seed, largest buckets placed first
+// while most slots are still free, false when a bucket finds no room
+static bool placeWords(stopwords *filter, stopwords_key *slots, uint32_t *displacements,
+                       const stopwords_key *keys, uint64_t seed) {
+    size_t count = filter->count;
+    size_t bucketCount = filter->bucket_count;
+    uint64_t *hashes = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+    size_t *order = (size_t *)malloc((count + 1) * sizeof(size_t));
+    BucketRange *ranges = (BucketRange *)calloc(bucketCount, sizeof(BucketRange));
+    bool *used = (bool *)calloc(count + 1, sizeof(bool));
+    bool ok = hashes != NULL && order != NULL && ranges != NULL && used != NULL;
+
+    // Words grouped by bucket: sizes, then starts, then the words themselves
+    for (size_t i = 0; ok && i < count; i++) {
+        hashes[i] = stopwords_hash(&keys[i], seed);
+        ranges[stopwords_bucket(hashes[i], bucketCount)].size++;
+    }
+    size_t start = 0;
+    for (size_t b = 0; ok && b < bucketCount; b++) {
+        ranges[b].bucket = b;
+        ranges[b].first = start;
+        start += ranges[b].size;
+        ranges[b].size = 0;
+        displacements[b] = 0;
+    }
+    for (size_t i = 0; ok && i < count; i++) {
+        BucketRange *range = &ranges[stopwords_bucket(hashes[i], bucketCount)];
+        order[range->first + range->size++] = i;
+    }
+    if (ok) {
+        qsort(ranges, bucketCount, sizeof(BucketRange), compareRanges);
+    }
+
+    size_t slotOf[STOPWORDS_BUCKET_SIZE * 8];
+    for (size_t b = 0; ok && b < bucketCount && ranges[b].size > 0; b++) {
+        const BucketRange *range = &ranges[b];
+        // A bucket this crowded means a poor seed, try the next one
+        ok = range->size <= sizeof(slotOf) / sizeof(slotOf[0]);
+        bool placed = false;
+        for (uint32_t d = 0; ok && !placed && d < STOPWORDS_MAX_DISPLACEMENT; d++) {
+            placed = true;
+            for (size_t w = 0; placed && w < range->size; w++) {
+                slotOf[w] = stopwords_slot(hashes[order[range->first + w]], d, count);
+                placed = !used[slotOf[w]];
+                for (size_t v = 0; placed && v < w; v++) {
+                    placed = slotOf[v] != slotOf[w];
+                }
+            }
+            if (placed) {
+                displacements[range->bucket] = d;
+                for (size_t w = 0; w < range->size; w++) {
+                    used[slotOf[w]] = true;
+                    slots[slotOf[w]] = keys[order[range->first + w]];
+                }
+            }
+        }
+        ok = ok && placed;
+    }
+
+    free(hashes);
+    free(order);
+    free(ranges);
+    free(used);
+    return ok;
+}
+
+static int compareKeys(const void *a, const void *b) {
+    const stopwords_key *keyA = (const stopwords_key *)a;
+    const stopwords_key *keyB = (const stopwords_key *)b;
+    if (keyA->head != keyB->head) {
+        return (keyA->head < keyB->head) ? -1 : 1;
+    }
+    if (keyA->tail != keyB->tail) {
+        return (keyA->tail < keyB->tail) ? -1 : 1;
+    }
+    return (keyA->length < keyB->length) ? -1 : (keyA->length > keyB->length);
+}
+
+// Largest buckets first, ties by bucket index so the order is reproducible
+static int compareRanges(const void *a, const void *b) {
+    const BucketRange *rangeA = (const BucketRange *)a;
+    const BucketRange *rangeB = (const BucketRange *)b;
+    if (rangeA->size != rangeB->size) {
+        return (rangeA->size > rangeB->size) ? -1 : 1;
+    }
+    return (rangeA->bucket < rangeB->bucket) ? -1 : (rangeA->bucket > rangeB->bucket);
+}
@@ -0,0 +1,360 @@
+/*
+ * Most Frequent Words - Pipelined stream input
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "streamReader_cfg.h"
+#include "streamReader.h"
+#include "stats.h"
+
+#if ZLIB_ENABLED
+#include <zlib.h>
+#endif
+
+// First two bytes of every gzip member (RFC 1952)
+#define GZIP_MAGIC_0 (0x1F)
+#define GZIP_MAGIC_1 (0x8B)
+
+// Ring of buffers shared by the reader thread and the scanning thread
+typedef struct {
+    int fd;                                         // descriptor being read
+    char prefix[2];                                 // first bytes, read to detect gzip
+    size_t prefixLength;                            // bytes of prefix not handed on yet
+    bool compressed;                                // gzip input, inflated into the buffers
+#if ZLIB_ENABLED
+    char *input;                                    // compressed bytes waiting to be inflated
+    bool inputEnded;                                // read() reported the end of the input
+    bool inMember;                                  // inside a gzip member, so the input must go on
+    z_stream inflater;                              // zlib state, used by the reader only
+#endif
+    char *buffers[STREAMREADER_RING_SIZE];          // buffer memory
+    size_t lengths[STREAMREADER_RING_SIZE];         // bytes of data in each filled buffer
+    size_t head;                                    // next buffer the reader fills
+    size_t tail;                                    // next buffer the scanner takes
+    size_t filled;                                  // buffers ready for the scanner
+    bool ended;                                     // the reader will fill no more buffers
+    bool failed;                                    // read() failed
+    bool stop;                                      // the scanner gave up, the reader must exit
+    bool scannerWaiting;                            // the scanner is blocked on an empty ring
+    pthread_mutex_t lock;                           // guards every field above except the buffers
+    pthread_cond_t dataReady;                       // a buffer was filled or input ended
+    pthread_cond_t spaceReady;                      // a buffer was released or scanning stopped
+    streamReader_stats stats;                       // reader and scanner fields, each written by one side
+} streamRing;
+
+// One read() retried on EINTR: bytes read, 0 at end of input, -1 on error
+static long readSome(int fd, char *buffer, size_t size) {
+    while (true) {
+#ifdef _WIN32
+        long got = (long)_read(fd, buffer, (unsigned int)(size > INT32_MAX ? INT32_MAX : size));
+#else
+        long got = (long)read(fd, buffer, size);
+#endif
+        if (got >= 0 || errno != EINTR) {
+            return got;
+        }
+    }
+}
+
+// The scanner is blocked waiting for data, so a partial buffer is better than none
+static bool scannerStarving(streamRing *ring) {
+    pthread_mutex_lock(&ring->lock);
+    bool starving = ring->scannerWaiting;
+    pthread_mutex_unlock(&ring->lock);
+    return starving;
+}
+
+// Read the input into buffer until it is full or the input ends, returns the bytes written
+static size_t readBuffer(streamRing *ring, char *buffer, bool pipelined, bool *ended, bool *failed) {
+    size_t length = ring->prefixLength;
+    memcpy(buffer, ring->prefix, ring->prefixLength);
+    ring->prefixLength = 0;
+
+    while (length < STREAMREADER_BUFFER_SIZE) {
+        long got = readSome(ring->fd, buffer + length, STREAMREADER_BUFFER_SIZE - length);
+        if (got <= 0) {
+            *failed = got < 0;
+            *ended = true;
+            break;
+        }
+        length += (size_t)got;
+        ring->stats.reads++;
+        ring->stats.bytes += (uint64_t)got;
+        if (pipelined && scannerStarving(ring)) {
+            break;
+        }
+    }
+    return length;
+}
+
+#if ZLIB_ENABLED
+// Inflate the input into buffer until it is full or the input ends, returns the bytes written
+static size_t inflateBuffer(streamRing *ring, char *buffer, bool pipelined, bool *ended, bool *failed) {
+    z_stream *stream = &ring->inflater;
+    stream->next_out = (Bytef *)buffer;
+    stream->avail_out = STREAMREADER_BUFFER_SIZE;
+
+    while (stream->avail_out > 0) {
+        if (stream->avail_in == 0) {
+            if (ring->inputEnded) {
+                *failed = ring->inMember; // Truncated in the middle of a member
+                *ended = true;
+                break;
+            }
+            long got = readSome(ring->fd, ring->input, STREAMREADER_BUFFER_SIZE);
+            if (got < 0) {
+                *failed = true;
+                *ended = true;
+                break;
+            }
+            ring->inputEnded = got == 0;
+            ring->stats.reads += got > 0;
+            ring->stats.bytes += (uint64_t)got;
+            stream->next_in = (Bytef *)ring->input;
+            stream->avail_in = (uInt)got;
+            continue;
+        }
+
+        uInt before = stream->avail_out;
+        int status = inflate(stream, Z_NO_FLUSH);
+        ring->stats.inflated += before - stream->avail_out;
+        if (status == Z_STREAM_END) {
+            // Members may follow each other, as cat a.gz b.gz writes them
+            ring->inMember = false;
+            if (inflateReset(stream) != Z_OK) {
+                *failed = true;
+                *ended = true;
+                break;
+            }
+        } else if (status == Z_OK) {
+            ring->inMember = true;
+        } else {
+            *failed = true; // Corrupt data, or memory ran out
+            *ended = true;
+            break;
+        }
+        if (pipelined && stream->avail_out < STREAMREADER_BUFFER_SIZE && scannerStarving(ring)) {
+            break;
+        }
+    }
+    return STREAMREADER_BUFFER_SIZE - stream->avail_out;
+}
+#endif
+
+// Fill buffer with the next bytes of text, ended and failed are set when the input ends
+static size_t fillBuffer(streamRing *ring, char *buffer, bool pipelined, bool *ended, bool *failed) {
+#if ZLIB_ENABLED
+    if (ring->compressed) {
+        return inflateBuffer(ring, buffer, pipelined, ended, failed);
+    }
+#endif
+    return readBuffer(ring, buffer, pipelined, ended, failed);
+}
+
+static void *readerThread(void *arg) {
+    streamRing *ring = (streamRing *)arg;
+    bool ended = false;
+    bool failed = false;
+
+    while (!ended) {
+        // Wait for a free buffer
+        pthread_mutex_lock(&ring->lock);
+        if (ring->filled == STREAMREADER_RING_SIZE && !ring->stop) {
+            double start = stats_now();
+            ring->stats.reader_stalls++;
+            while (ring->filled == STREAMREADER_RING_SIZE && !ring->stop) {
+                pthread_cond_wait(&ring->spaceReady, &ring->lock);
+            }
+            ring->stats.reader_wait_s += stats_now() - start;
+        }
+        bool stop = ring->stop;
+        size_t slot = ring->head;
+        pthread_mutex_unlock(&ring->lock);
+        if (stop) {
+            break;
+        }
+
+        // Fill it, or hand it over early if the scanner is idle
+        size_t length = fillBuffer(ring, ring->buffers[slot], true, &ended, &failed);
+
+        pthread_mutex_lock(&ring->lock);
+        if (length > 0) {
+            ring->lengths[slot] = length;
+            ring->head = (ring->head + 1) % STREAMREADER_RING_SIZE;
+            ring->filled++;
+        }
+        ring->ended = ended;
+        ring->failed = failed;
+        pthread_cond_signal(&ring->dataReady);
+        pthread_mutex_unlock(&ring->lock);
+    }
+    return NULL;
+}
+
+// Without a reader thread: read and scan in turn on the calling thread
+static bool scanSerially(streamRing *ring, wordScanner *scanner) {
+    bool ok = true;
+    bool ended = false;
+    bool failed = false;
+    while (ok && !ended) {
+        size_t length = fillBuffer(ring, ring->buffers[0], false, &ended, &failed);
+        if (length > 0) {
+            ring->stats.buffers++;
+            ok = wordScanner_feed(scanner, ring->buffers[0], length);
+        }
+    }
+    return ok && !failed && wordScanner_finish(scanner);
+}
+
+// Read the first bytes and set up inflating if they start a gzip member
+static bool detectCompression(streamRing *ring) {
+    while (ring->prefixLength < sizeof(ring->prefix)) {
+        long got = readSome(ring->fd, ring->prefix + ring->prefixLength, sizeof(ring->prefix) - ring->prefixLength);
+        if (got < 0) {
+            return false;
+        }
+        if (got == 0) {
+            return true; // Too short to be compressed
+        }
+        ring->prefixLength += (size_t)got;
+        ring->stats.reads++;
+        ring->stats.bytes += (uint64_t)got;
+    }
+    ring->compressed = streamReader_isCompressed(ring->prefix, ring->prefixLength);
+    if (!ring->compressed) {
+        return true;
+    }
+
+#if ZLIB_ENABLED
+    ring->input = (char *)malloc(STREAMREADER_BUFFER_SIZE);
+    if (ring->input == NULL) {
+        return false;
+    }
+    // 16 + MAX_WBITS: gzip framing only, with its header and CRC checked
+    if (inflateInit2(&ring->inflater, 16 + MAX_WBITS) != Z_OK) {
+        free(ring->input);
+        ring->input = NULL;
+        return false;
+    }
+    memcpy(ring->input, ring->prefix, ring->prefixLength);
+    ring->inflater.next_in = (Bytef *)ring->input;
+    ring->inflater.avail_in = (uInt)ring->prefixLength;
+    ring->prefixLength = 0;
+    return true;
+#else
+    return false; // Built without zlib
+#endif
+}
+
+// Scan buffers as the reader thread fills them, until input ends or scanning fails
+static bool scanPipelined(streamRing *ring, wordScanner *scanner) {
+    bool ok = true;
+
+    while (ok) {
+        pthread_mutex_lock(&ring->lock);
+        if (ring->filled == 0 && !ring->ended) {
+            double start = stats_now();
+            ring->stats.scanner_stalls++;
+            ring->scannerWaiting = true;
+            while (ring->filled == 0 && !ring->ended) {
+                pthread_cond_wait(&ring->dataReady, &ring->lock);
+            }
+            ring->scannerWaiting = false;
+            ring->stats.scanner_wait_s += stats_now() - start;
+        }
+        size_t slot = ring->tail;
+        bool drained = ring->filled == 0;
+        pthread_mutex_unlock(&ring->lock);
+        if (drained) {
+            break; // Input ended and every buffer was scanned
+        }
+
+        ok = wordScanner_feed(scanner, ring->buffers[slot], ring->lengths[slot]);
+        ring->stats.buffers++;
+
+        pthread_mutex_lock(&ring->lock);
+        ring->tail = (ring->tail + 1) % STREAMREADER_RING_SIZE;
+        ring->filled--;
+        pthread_cond_signal(&ring->spaceReady);
+        pthread_mutex_unlock(&ring->lock);
+    }
+
+    // Release a reader blocked on a full ring
+    pthread_mutex_lock(&ring->lock);
+    ring->stop = !ok;
+    pthread_cond_signal(&ring->spaceReady);
+    pthread_mutex_unlock(&ring->lock);
+    return ok;
+}
+
+bool streamReader_scanFd(int fd, wordScanner *scanner, streamReader_stats *stats) {
+    streamRing *ring = (streamRing *)calloc(1, sizeof(streamRing));
+    if (ring == NULL) {
+        return false;
+    }
+    ring->fd = fd;
+
+    bool ok = true;
+    for (size_t i = 0; i < STREAMREADER_RING_SIZE; i++) {
+        ring->buffers[i] = (char *)malloc(STREAMREADER_BUFFER_SIZE);
+        ok = ok && ring->buffers[i] != NULL;
+    }
+
+    double start = stats_now();
+    ok = ok && detectCompression(ring);
+    if (ok) {
+        pthread_t reader;
+        pthread_mutex_init(&ring->lock, NULL);
+        pthread_cond_init(&ring->dataReady, NULL);
+        pthread_cond_init(&ring->spaceReady, NULL);
+        if (pthread_create(&reader, NULL, readerThread, ring) == 0) {
+            ok = scanPipelined(ring, scanner);
+            pthread_join(reader, NULL);
+            ok = ok && !ring->failed && wordScanner_finish(scanner);
+        } else {
+            ok = scanSerially(ring, scanner);
+        }
+        pthread_cond_destroy(&ring->spaceReady);
+        pthread_cond_destroy(&ring->dataReady);
+        pthread_mutex_destroy(&ring->lock);
+    }
+    ring->stats.elapsed_s = stats_now() - start;
+
+    if (stats != NULL) {
+        *stats = ring->stats;
+    }
+#if ZLIB_ENABLED
+    if (ring->input != NULL) {
+        inflateEnd(&ring->inflater);
+        free(ring->input);
+    }
+#endif
+    for (size_t i = 0; i < STREAMREADER_RING_SIZE; i++) {
+        free(ring->buffers[i]);
+    }
+    free(ring);
+    return ok;
+}
+
+bool streamReader_isCompressed(const char *data, size_t length) {
+    return length >= 2 && (unsigned char)data[0] == GZIP_MAGIC_0 && (unsigned char)data[1] == GZIP_MAGIC_1;
+}
+
+bool streamReader_canDecompress(void) {
+    return ZLIB_ENABLED;
+}
@@ -0,0 +1,189 @@
+/*
+ * Most Frequent Words - Top-N selection
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "topN_cfg.h"
+#include "topN.h"
+
+static void siftDown(WordCount *heap, size_t size, size_t index);
+static bool partialSelect(hashTable *freqMap, size_t n, WordCount *result);
+static void quickSelect(WordCount *items, size_t count, size_t k);
+static void swapWordCount(WordCount *a, WordCount *b);
+
+int cmpWordCount(const void *a, const void *b) {
+    const WordCount *wcA = (const WordCount *)a;
+    const WordCount *wcB = (const WordCount *)b;
+
+    // Sort primarily by count in descending order
+    if (wcA->count != wcB->count) {
+        return (wcA->count > wcB->count) ? -1 : 1; // Descending order
+    }
+    // If counts are equal, sort alphabetically in ascending order
+    return strcmp(wcA->word, wcB->word);
+}
+
+bool topN_select(hashTable *freqMap, size_t n, WordCount *result, size_t *selected) {
+    size_t length = hashTable_getLength(freqMap);
+    size_t count = (n < length) ? n : length;
+
+    *selected = 0;
+    if (count == 0) {
+        return true;
+    }
+
+    if (count <= length / TOPN_HEAP_MAX_FRACTION) {
+        // Keep the n best words in a heap stored in result
+        topN_heap heap;
+        topN_heapInit(&heap, result, count);
+
+        hashTable_iterator freqMapItr;
+        hashTable_initIterator(freqMap, &freqMapItr);
+        const char *key;
+        void *value;
+        while (hashTable_iteratorNext(&freqMapItr, &key, &value)) {
+            topN_heapOffer(&heap, key, *(const uint64_t *)value);
+        }
+        *selected = topN_heapFinish(&heap);
+        return true;
+    }
+    if (!partialSelect(freqMap, count, result)) {
+        return false;
+    }
+
+    // Only the selected words are sorted into ranking order
+    qsort(result, count, sizeof(WordCount), cmpWordCount);
+    *selected = count;
+    return true;
+}
+
+void topN_heapInit(topN_heap *heap, WordCount *result, size_t n) {
+    heap->heap = result;
+    heap->capacity = n;
+    heap->size = 0;
+}
+
+void topN_heapOffer(topN_heap *heap, const char *word, uint64_t count) {
+    WordCount candidate = { word, count };
+
+    if (heap->size < heap->capacity) {
+        heap->heap[heap->size++] = candidate;
+        if (heap->size == heap->capacity) {
+            // Heapify once the heap is full
+            for (size_t i = heap->capacity / 2; i-- > 0;) {
+                siftDown(heap->heap, heap->capacity, i);
+            }
+        }
+    } else if (heap->capacity > 0 && cmpWordCount(&candidate, &heap->heap[0]) < 0) {
+        // Better than the worst kept word, replace it
+        heap->heap[0] = candidate;
+        siftDown(heap->heap, heap->capacity, 0);
+    }
+}
+
+size_t topN_heapFinish(topN_heap *heap) {
+    // Only the kept words are sorted into ranking order
+    qsort(heap->heap, heap->size, sizeof(WordCount), cmpWordCount);
+    return heap->size;
+}
+
+// Restore the heap property below index, the worst ranked word stays at the root
+static void siftDown(WordCount *heap, size_t size, size_t index) {
+    while (true) {
+        size_t worst = index;
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+
+        if (left < size && cmpWordCount(&heap[left], &heap[worst]) > 0) {
+            worst = left;
+        }
+        if (right < size && cmpWordCount(&heap[right], &heap[worst]) > 0) {
+            worst = right;
+        }
+        if (worst == index) {
+            return;
+        }
+        swapWordCount(&heap[index], &heap[worst]);
+        index = worst;
+    }
+}
+
+// Gather every word and partition the n best to the front (n <= table length)
+static bool partialSelect(hashTable *freqMap, size_t n, WordCount *result) {
+    size_t length = hashTable_getLength(freqMap);
+    WordCount *items = (WordCount *)malloc(length * sizeof(WordCount));
+    if (items == NULL) {
+        return false;
+    }
+
+    hashTable_iterator freqMapItr;
+    hashTable_initIterator(freqMap, &freqMapItr);
+
+    const char *key;
+    void *value;
+    size_t i = 0;
+    while (hashTable_iteratorNext(&freqMapItr, &key, &value)) {
+        items[i].word = key;
+        items[i].count = *(const uint64_t *)value;
+        i++;
+    }
+
+    if (n < length) {
+        quickSelect(items, length, n);
+    }
+    memcpy(result, items, n * sizeof(WordCount));
+    free(items);
+    return true;
+}
+
+// Reorder items so the k best ranked ones come first, in no particular order
+static void quickSelect(WordCount *items, size_t count, size_t k) {
+    size_t low = 0;
+    size_t high = count - 1;
+
+    while (low < high) {
+        // Median of three pivot, moved to high
+        size_t mid = low + (high - low) / 2;
+        if (cmpWordCount(&items[mid], &items[low]) < 0) {
+            swapWordCount(&items[mid], &items[low]);
+        }
+        if (cmpWordCount(&items[high], &items[low]) < 0) {
+            swapWordCount(&items[high], &items[low]);
+        }
+        if (cmpWordCount(&items[mid], &items[high]) < 0) {
+            swapWordCount(&items[mid], &items[high]);
+        }
+
+        // Lomuto partition around items[high]
+        size_t store = low;
+        for (size_t i = low; i < high; i++) {
+            if (cmpWordCount(&items[i], &items[high]) < 0) {
+                swapWordCount(&items[i], &items[store]);
+                store++;
+            }
+        }
+        swapWordCount(&items[store], &items[high]);
+
+        // items[store] now has exactly store better ranked words before it
+        if (store == k || store + 1 == k) {
+            return;
+        }
+        if (store > k) {
+            high = store - 1;
+        } else {
+            low = store + 1;
+        }
+    }
+}
+
+static void swapWordCount(WordCount *a, WordCount *b) {
+    WordCount tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
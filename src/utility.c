@@ -4,24 +4,209 @@
  * Licensed under the MIT License - see LICENSE file for details
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <ctype.h>
 
+#include "charClass.h"
+#include "unicodeTables.h"
 #include "utility.h"
 
+static size_t cleanSlice(char *dst, const char *src, size_t length, bool *stopped, size_t *consumed);
+static size_t cleanUtf8(char *dst, const char *src, size_t length, size_t limit, bool *stopped,
+                        size_t *consumed);
+static size_t decodeUtf8(const unsigned char *bytes, size_t length, uint32_t *codePoint);
+static size_t encodeUtf8(uint32_t codePoint, char *out);
+
 void clean_and_lowercase(char *word) {
-    char *srcPtr = word;
-    char *dstPtr = word;
-    while(*srcPtr) {
-        // Check if the character is NOT punctuation
-        if (!ispunct(*srcPtr)) {
-            *dstPtr = tolower(*srcPtr);
-            dstPtr++; // Move destination pointer forward
-        }
-        srcPtr++; // Move source pointer forward
-    }
-    *dstPtr = '\0'; // Null-terminate the cleaned string
-}
\ No newline at end of file
+    size_t length = clean_and_lowercase_slice(word, word, strlen(word));
+    word[length] = '\0'; // Null-terminate the cleaned string
+}
+
+size_t clean_and_lowercase_slice(char *dst, const char *src, size_t length) {
+    size_t consumed;
+    return cleanSlice(dst, src, length, NULL, &consumed);
+}
+
+size_t clean_and_lowercase_next(char *dst, const char *src, size_t length, size_t *consumed) {
+    bool stopped = false;
+    return cleanSlice(dst, src, length, &stopped, consumed);
+}
+
+// Clean a slice, ASCII blocks through the kernels and the rest a code point at a time
+static size_t cleanSlice(char *dst, const char *src, size_t length, bool *stopped, size_t *consumed) {
+    char *dstPtr = dst;
+    // Cache line aligned: byte loads from a vector store split across two lines cannot be forwarded
+    char block[CHARCLASS_BLOCK_SIZE] __attribute__((aligned(CHARCLASS_BLOCK_SIZE)));
+    charClass_masks masks;
+    size_t offset = 0;
+
+    // Words shorter than a block are cheaper to clean a byte at a time
+    if (length < CHARCLASS_BLOCK_SIZE) {
+        for (size_t i = 0; i < length; i++) {
+            unsigned char c = (unsigned char)src[i];
+            if (c >= 0x80) {
+                // Not ASCII, clean the rest as UTF-8
+                size_t rest;
+                dstPtr += cleanUtf8(dstPtr, src + i, length - i, length - i, stopped, &rest);
+                *consumed = i + rest;
+                return (size_t)(dstPtr - dst);
+            }
+            // Check if the character is NOT punctuation
+            if (!charClass_isPunctuation(c)) {
+                *dstPtr++ = (char)charClass_toLower(c);
+            }
+        }
+        *consumed = length;
+        return (size_t)(dstPtr - dst);
+    }
+
+    while (offset < length) {
+        size_t blockLength = length - offset;
+        const char *blockPtr = src + offset;
+
+        if (blockLength >= CHARCLASS_BLOCK_SIZE) {
+            blockLength = CHARCLASS_BLOCK_SIZE;
+        } else {
+            // Pad the last partial block so the kernels can read a full block
+            memcpy(block, blockPtr, blockLength);
+            memset(block + blockLength, ' ', CHARCLASS_BLOCK_SIZE - blockLength);
+            blockPtr = block;
+        }
+        charClass_classifyBlock(blockPtr, &masks);
+
+        if (masks.nonAscii != 0) {
+            // Clean the block as UTF-8, finishing a sequence that runs past its end
+            size_t used;
+            dstPtr += cleanUtf8(dstPtr, src + offset, length - offset, blockLength, stopped, &used);
+            offset += used;
+            if (stopped != NULL && *stopped) {
+                break;
+            }
+            continue;
+        }
+        if (masks.punctuation == 0 && blockLength == CHARCLASS_BLOCK_SIZE) {
+            // Nothing to remove, lowercase the block straight into dst
+            charClass_lowercaseBlock(blockPtr, dstPtr);
+            dstPtr += CHARCLASS_BLOCK_SIZE;
+        } else {
+            // Lowercase the block, then keep every byte that is NOT punctuation
+            charClass_lowercaseBlock(blockPtr, block);
+            uint64_t keep = ~masks.punctuation;
+            if (blockLength < CHARCLASS_BLOCK_SIZE) {
+                keep &= ((uint64_t)1 << blockLength) - 1;
+            }
+            while (keep != 0) {
+                *dstPtr++ = block[__builtin_ctzll(keep)];
+                keep &= keep - 1; // Move to the next kept byte
+            }
+        }
+        offset += blockLength;
+    }
+    *consumed = offset;
+    return (size_t)(dstPtr - dst); // Length of the cleaned word
+}
+
+// Clean code points starting in the first limit bytes of src, returns the bytes written to dst
+static size_t cleanUtf8(char *dst, const char *src, size_t length, size_t limit, bool *stopped,
+                        size_t *consumed) {
+    const unsigned char *bytes = (const unsigned char *)src;
+    char *dstPtr = dst;
+    size_t i = 0;
+
+    while (i < limit) {
+        unsigned char c = bytes[i];
+        if (c < 0x80) {
+            if (!charClass_isPunctuation(c)) {
+                *dstPtr++ = (char)charClass_toLower(c);
+            }
+            i++;
+            continue;
+        }
+
+        uint32_t codePoint;
+        size_t sequence = decodeUtf8(bytes + i, length - i, &codePoint);
+        if (sequence == 0) {
+            *dstPtr++ = (char)c; // Not UTF-8, the byte is kept as it is
+            i++;
+            continue;
+        }
+        i += sequence;
+
+        const unicodeTables_property *property = unicodeTables_lookup(codePoint);
+        if (property->charClass == UNICODETABLES_WHITESPACE) {
+            if (stopped != NULL) {
+                *stopped = true;
+                break;
+            }
+        } else if (property->charClass == UNICODETABLES_KEPT) {
+            // The folded code point is never longer, so dst never overtakes src
+            dstPtr += encodeUtf8((uint32_t)((int32_t)codePoint + property->foldDelta), dstPtr);
+        }
+    }
+    *consumed = i;
+    return (size_t)(dstPtr - dst);
+}
+
+// Length of the UTF-8 sequence starting at bytes, 0 if it is truncated, overlong, a surrogate or out of range
+static size_t decodeUtf8(const unsigned char *bytes, size_t length, uint32_t *codePoint) {
+    unsigned char lead = bytes[0];
+    size_t sequence;
+    uint32_t value;
+    uint32_t smallest;
+
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        sequence = 2;
+        value = lead & 0x1F;
+        smallest = 0x80;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        sequence = 3;
+        value = lead & 0x0F;
+        smallest = 0x800;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        sequence = 4;
+        value = lead & 0x07;
+        smallest = 0x10000;
+    } else {
+        return 0; // A continuation byte, or a lead byte no valid sequence starts with
+    }
+    if (sequence > length) {
+        return 0;
+    }
+    for (size_t i = 1; i < sequence; i++) {
+        if ((bytes[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+        value = (value << 6) | (bytes[i] & 0x3F);
+    }
+    if (value < smallest || value > UNICODETABLES_MAX_CODE_POINT || (value >= 0xD800 && value <= 0xDFFF)) {
+        return 0;
+    }
+    *codePoint = value;
+    return sequence;
+}
+
+static size_t encodeUtf8(uint32_t codePoint, char *out) {
+    if (codePoint < 0x80) {
+        out[0] = (char)codePoint;
+        return 1;
+    }
+    if (codePoint < 0x800) {
+        out[0] = (char)(0xC0 | (codePoint >> 6));
+        out[1] = (char)(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint < 0x10000) {
+        out[0] = (char)(0xE0 | (codePoint >> 12));
+        out[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (codePoint >> 18));
+    out[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (codePoint & 0x3F));
+    return 4;
+}
@@ -0,0 +1,222 @@
+/*
+ * Most Frequent Words - In-place word scanner
+ * Copyright (c) 2025 ahmed khaled
+ * Licensed under the MIT License - see LICENSE file for details
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "charClass.h"
+#include "utility.h"
+#include "wordScanner.h"
+
+// Initial size of the scratch buffer, grown on demand for longer words
+#define WORD_SCANNER_INITIAL_BUFFER (256)
+
+// Punctuation, uppercase letters or UTF-8, i.e. bytes the cleaner may change
+static inline bool needsCleaning(unsigned char c) {
+    return charClass_isPunctuation(c) || charClass_isUppercase(c) || c >= 0x80;
+}
+
+static bool reserveBuffer(wordScanner *scanner, size_t size) {
+    if (size <= scanner->bufferCapacity) {
+        return true;
+    }
+
+    size_t newCapacity = (scanner->bufferCapacity == 0) ? WORD_SCANNER_INITIAL_BUFFER
+                                                        : scanner->bufferCapacity;
+    while (newCapacity < size) {
+        newCapacity *= 2;
+    }
+    char *grown = realloc(scanner->buffer, newCapacity);
+    if (grown == NULL) {
+        return false;
+    }
+    scanner->buffer = grown;
+    scanner->bufferCapacity = newCapacity;
+    return true;
+}
+
+static inline bool deliverWord(wordScanner *scanner, const char *word, size_t length) {
+    if (scanner->filter != NULL && stopwords_contains(scanner->filter, word, length)) {
+        return true; // Stopwords are dropped before they are hashed
+    }
+    if (scanner->hashedCallback != NULL) {
+        // Hash the word while its bytes are still in the L1 cache
+        uint64_t hash = scanner->hash(word, length, scanner->hashSeed);
+        return scanner->hashedCallback(word, length, hash, scanner->context);
+    }
+    return scanner->callback(word, length, scanner->context);
+}
+
+static bool emitWord(wordScanner *scanner, const char *word, size_t length, bool dirty) {
+    if (!dirty) {
+        return deliverWord(scanner, word, length);
+    }
+
+    // Clean into the scratch buffer (in place when the word is the carried one)
+    if (word != scanner->buffer && !reserveBuffer(scanner, length)) {
+        return false;
+    }
+    // Whitespace beyond ASCII splits the run into several words
+    while (length > 0) {
+        size_t consumed;
+        size_t cleaned = clean_and_lowercase_next(scanner->buffer, word, length, &consumed);
+        if (cleaned > 0 && !deliverWord(scanner, scanner->buffer, cleaned)) {
+            return false;
+        }
+        word += consumed; // Words that were only punctuation are skipped
+        length -= consumed;
+    }
+    return true;
+}
+
+static bool carryWord(wordScanner *scanner, const char *bytes, size_t length, bool dirty) {
+    if (!reserveBuffer(scanner, scanner->carryLength + length)) {
+        return false;
+    }
+    memcpy(scanner->buffer + scanner->carryLength, bytes, length);
+    scanner->carryLength += length;
+    scanner->carryDirty = scanner->carryDirty || dirty;
+    return true;
+}
+
+void wordScanner_init(wordScanner *scanner, wordScanner_callback callback, void *context) {
+    scanner->callback = callback;
+    scanner->hashedCallback = NULL;
+    scanner->hash = NULL;
+    scanner->hashSeed = 0;
+    scanner->context = context;
+    scanner->filter = NULL;
+    scanner->buffer = NULL;
+    scanner->bufferCapacity = 0;
+    scanner->carryLength = 0;
+    scanner->carryDirty = false;
+}
+
+void wordScanner_initHashed(wordScanner *scanner, wordScanner_hashedCallback callback,
+                            hashFunctions_fn hash, uint64_t seed, void *context) {
+    wordScanner_init(scanner, NULL, context);
+    scanner->hashedCallback = callback;
+    scanner->hash = hash;
+    scanner->hashSeed = seed;
+}
+
+void wordScanner_setFilter(wordScanner *scanner, const stopwords *filter) {
+    scanner->filter = filter;
+}
+
+bool wordScanner_feed(wordScanner *scanner, const char *data, size_t length) {
+    size_t pos = 0;
+
+    // Complete the word left unfinished by the previous buffer
+    if (scanner->carryLength > 0) {
+        bool dirty = false;
+        while (pos < length && !charClass_isWhitespace((unsigned char)data[pos])) {
+            dirty |= needsCleaning((unsigned char)data[pos]);
+            pos++;
+        }
+        if (!carryWord(scanner, data, pos, dirty)) {
+            return false;
+        }
+        if (pos == length) {
+            return true; // The whole buffer belongs to the carried word
+        }
+        if (!wordScanner_finish(scanner)) {
+            return false;
+        }
+    }
+
+    // Classify a block at a time and walk word boundaries through the masks
+    char padded[CHARCLASS_BLOCK_SIZE];
+    size_t wordStart = 0;
+    bool inWord = false;
+    bool dirty = false;
+
+    for (size_t base = pos; base < length; base += CHARCLASS_BLOCK_SIZE) {
+        charClass_masks masks;
+        uint64_t valid = ~(uint64_t)0; // bits of bytes that belong to data
+        size_t blockLength = length - base;
+
+        if (blockLength >= CHARCLASS_BLOCK_SIZE) {
+            charClass_classifyBlock(data + base, &masks);
+        } else {
+            // Pad the last partial block so the kernels can read a full block
+            memcpy(padded, data + base, blockLength);
+            memset(padded + blockLength, ' ', CHARCLASS_BLOCK_SIZE - blockLength);
+            charClass_classifyBlock(padded, &masks);
+            valid = ((uint64_t)1 << blockLength) - 1;
+        }
+
+        uint64_t space = masks.whitespace & valid;
+        uint64_t wordBytes = ~masks.whitespace & valid;
+        uint64_t changed = masks.punctuation | masks.uppercase | masks.nonAscii;
+        unsigned int bit = 0; // next byte of the block to look at
+
+        while (bit < CHARCLASS_BLOCK_SIZE) {
+            uint64_t ahead = ~(uint64_t)0 << bit;
+
+            if (!inWord) {
+                // Skip whitespace to the next word start
+                uint64_t starts = wordBytes & ahead;
+                if (starts == 0) {
+                    break;
+                }
+                bit = (unsigned int)__builtin_ctzll(starts);
+                wordStart = base + bit;
+                inWord = true;
+                dirty = false;
+            } else {
+                // Find the whitespace ending the word, noting whether it needs cleaning
+                uint64_t ends = space & ahead;
+                if (ends == 0) {
+                    dirty |= (changed & ahead) != 0;
+                    break; // The word continues in the next block
+                }
+                unsigned int end = (unsigned int)__builtin_ctzll(ends);
+                dirty |= (changed & ahead & (((uint64_t)1 << end) - 1)) != 0;
+                if (!emitWord(scanner, data + wordStart, base + end - wordStart, dirty)) {
+                    return false;
+                }
+                inWord = false;
+                bit = end;
+            }
+        }
+    }
+
+    if (inWord) {
+        // The word may continue in the next buffer
+        return carryWord(scanner, data + wordStart, length - wordStart, dirty);
+    }
+    return true;
+}
+
+bool wordScanner_finish(wordScanner *scanner) {
+    if (scanner->carryLength == 0) {
+        return true;
+    }
+
+    size_t length = scanner->carryLength;
+    bool dirty = scanner->carryDirty;
+    scanner->carryLength = 0;
+    scanner->carryDirty = false;
+    return emitWord(scanner, scanner->buffer, length, dirty);
+}
+
+void wordScanner_destroy(wordScanner *scanner) {
+    free(scanner->buffer);
+    scanner->buffer = NULL;
+    scanner->bufferCapacity = 0;
+    scanner->carryLength = 0;
+    scanner->carryDirty = false;
+}
+
+size_t wordScanner_nextBoundary(const char *data, size_t length, size_t offset) {
+    while (offset < length && !charClass_isWhitespace((unsigned char)data[offset])) {
+        offset++;
+    }
+    return offset;
+}
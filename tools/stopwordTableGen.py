@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# Most Frequent Words - Stopword table generator
+# Copyright (c) 2025 ahmed khaled
+# Licensed under the MIT License - see LICENSE file for details
+#
+# Usage: python3 tools/stopwordTableGen.py cfg/stopwords.txt > src/stopwordTable.c
+#
+# Builds the minimal perfect hash behind stopwords_builtin from a list of
+# words separated by whitespace, the way stopwords_create() builds one at
+# run time: same keys, same hash, same bucket order and displacement search,
+# so both agree on every word. Words must already be clean (lowercase, no
+# ASCII punctuation) since the scanner compares cleaned words.
+
+import string
+import sys
+
+MAX_LENGTH = 16                     # must match STOPWORDS_MAX_LENGTH
+BUCKET_SIZE = 4                     # must match STOPWORDS_BUCKET_SIZE
+MAX_DISPLACEMENT = 1 << 20          # must match STOPWORDS_MAX_DISPLACEMENT
+MAX_ATTEMPTS = 64                   # must match STOPWORDS_MAX_ATTEMPTS
+MASK64 = (1 << 64) - 1
+MASK32 = (1 << 32) - 1
+
+
+def read32(word, offset):
+    return int.from_bytes(word[offset:offset + 4], "little")
+
+
+# stopwords_makeKey(): (head, tail, length)
+def make_key(word):
+    length = len(word)
+    if length >= 4:
+        shift = (length >> 3) << 2
+        head = (read32(word, 0) << 32) | read32(word, shift)
+        tail = (read32(word, length - 4) << 32) | read32(word, length - 4 - shift)
+    else:
+        head = (word[0] << 16) | (word[length >> 1] << 8) | word[length - 1]
+        tail = 0
+    return (head, tail, length)
+
+
+def word_hash(key, seed):
+    head, tail, length = key
+    h = ((head ^ seed) * 0x9E3779B97F4A7C15) & MASK64
+    h ^= ((tail + length) * 0xC2B2AE3D27D4EB4F) & MASK64
+    h ^= h >> 29
+    h = (h * 0xBF58476D1CE4E5B9) & MASK64
+    return h ^ (h >> 32)
+
+
+def slot_of(h, displacement, count):
+    mixed = ((((h & MASK32) ^ displacement) * 0x9E3779B97F4A7C15) & MASK64) >> 32
+    return (mixed * count) >> 32
+
+
+def bucket_of(h, bucket_count):
+    return ((h >> 32) * bucket_count) >> 32
+
+
+# placeWords(): slots and displacements under seed, None if a bucket finds no room
+def place_words(keys, bucket_count, seed):
+    count = len(keys)
+    hashes = [word_hash(key, seed) for key in keys]
+    members = [[] for _ in range(bucket_count)]
+    for i, h in enumerate(hashes):
+        members[bucket_of(h, bucket_count)].append(i)
+    order = sorted(range(bucket_count), key=lambda b: (-len(members[b]), b))
+
+    slots = [None] * count
+    displacements = [0] * bucket_count
+    for bucket in order:
+        words = members[bucket]
+        if not words:
+            break
+        if len(words) > BUCKET_SIZE * 8:
+            return None
+        for displacement in range(MAX_DISPLACEMENT):
+            taken = [slot_of(hashes[i], displacement, count) for i in words]
+            if len(set(taken)) == len(taken) and all(slots[s] is None for s in taken):
+                displacements[bucket] = displacement
+                for i, s in zip(words, taken):
+                    slots[s] = keys[i]
+                break
+        else:
+            return None
+    return slots, displacements
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: stopwordTableGen.py stopwords.txt > src/stopwordTable.c")
+    with open(sys.argv[1], "rb") as f:
+        words = f.read().split()
+
+    by_key = {}
+    for word in words:
+        text = word.decode("utf-8")
+        if len(word) > MAX_LENGTH or text != text.lower() or any(c in string.punctuation for c in text):
+            sys.exit("stopword %r is not a clean word of at most %d bytes" % (text, MAX_LENGTH))
+        by_key.setdefault(make_key(word), word)
+    keys = sorted(by_key)
+
+    bucket_count = len(keys) // BUCKET_SIZE + 1
+    for attempt in range(1, MAX_ATTEMPTS + 1):
+        seed = (attempt * 0x9E3779B97F4A7C15) & MASK64
+        placed = place_words(keys, bucket_count, seed)
+        if placed is not None:
+            break
+    else:
+        sys.exit("no perfect hash found for %d words" % len(keys))
+    slots, displacements = placed
+    lengths = 0
+    for key in keys:
+        lengths |= 1 << key[2]
+
+    out = sys.stdout
+    out.write("/*\n")
+    out.write(" * Most Frequent Words - Built-in stopword table\n")
+    out.write(" * Copyright (c) 2025 ahmed khaled\n")
+    out.write(" * Licensed under the MIT License - see LICENSE file for details\n")
+    out.write(" *\n")
+    out.write(" * Generated by tools/stopwordTableGen.py from %s, do not edit.\n" % sys.argv[1])
+    out.write(" * %d words in %d slots, %d buckets, %d bytes in all.\n"
+              % (len(keys), len(slots), bucket_count, len(slots) * 24 + bucket_count * 4))
+    out.write(" */\n\n")
+    out.write("#include <stdint.h>\n\n")
+    out.write("#include \"stopwords.h\"\n\n")
+    out.write("// Fails to compile if the generator and the header disagree on the key size\n")
+    out.write("typedef char stopwordTable_maxLengthMatches[(STOPWORDS_MAX_LENGTH == %d) ? 1 : -1];\n\n" % MAX_LENGTH)
+
+    out.write("static const stopwords_key stopwordTable_keys[%d] = {\n" % max(len(slots), 1))
+    for key in slots:
+        out.write("    { UINT64_C(0x%016x), UINT64_C(0x%016x), %2d }, // %s\n"
+                  % (key[0], key[1], key[2], by_key[key].decode("utf-8")))
+    if not slots:
+        out.write("    { 0, 0, 0 },\n")
+    out.write("};\n\n")
+
+    out.write("static const uint32_t stopwordTable_displacements[%d] = {\n" % bucket_count)
+    for row in range(0, bucket_count, 8):
+        out.write("    " + ", ".join("%7d" % value for value in displacements[row:row + 8]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("const stopwords stopwords_builtin = {\n")
+    out.write("    stopwordTable_keys, stopwordTable_displacements, %d, %d, UINT64_C(0x%016x), 0x%08x\n"
+              % (len(slots), bucket_count, seed, lengths))
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+#
+# Most Frequent Words - Unicode table generator
+# Copyright (c) 2025 ahmed khaled
+# Licensed under the MIT License - see LICENSE file for details
+#
+# Usage: python3 tools/unicodeTablesGen.py > src/unicodeTables.c
+#
+# Writes the two-stage tables behind unicodeTables_lookup() from the
+# unicodedata module of the running Python, so the Unicode version follows
+# the Python used. Every code point gets a class and a case folding delta:
+#   - whitespace: Zs, Zl, Zp and NEL, plus the C locale whitespace and NUL
+#   - removed:    punctuation (P*), symbols (S*) and format characters (Cf)
+#   - kept:       everything else, folded to its simple case folding
+# A folding whose UTF-8 encoding is longer than the original is dropped, so
+# cleaning a word never makes it longer and can run in place.
+# Code points are split into blocks of 1 << BLOCK_SHIFT, identical blocks
+# are stored once, and each entry of a block indexes a (class, delta) pair.
+
+import sys
+import unicodedata
+
+BLOCK_SHIFT = 7                     # must match UNICODETABLES_BLOCK_SHIFT
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+CODE_POINTS = 0x110000
+
+CLASS_KEPT = 0
+CLASS_REMOVED = 1
+CLASS_WHITESPACE = 2
+CLASS_NAMES = ["UNICODETABLES_KEPT", "UNICODETABLES_REMOVED", "UNICODETABLES_WHITESPACE"]
+
+
+def utf8_length(code_point):
+    if code_point < 0x80:
+        return 1
+    if code_point < 0x800:
+        return 2
+    if code_point < 0x10000:
+        return 3
+    return 4
+
+
+def classify(code_point):
+    if code_point == 0 or code_point == 0x20 or 0x09 <= code_point <= 0x0D or code_point == 0x85:
+        return CLASS_WHITESPACE
+    category = unicodedata.category(chr(code_point))
+    if category in ("Zs", "Zl", "Zp"):
+        return CLASS_WHITESPACE
+    if category[0] in "PS" or category == "Cf":
+        return CLASS_REMOVED
+    return CLASS_KEPT
+
+
+# Simple case folding: casefold() when it maps to one character, else lower()
+# when that does (the full folding of U+1E9E is "ss", its simple one U+00DF)
+def fold(code_point):
+    if 0xD800 <= code_point <= 0xDFFF:
+        return code_point
+    for mapped in (chr(code_point).casefold(), chr(code_point).lower()):
+        if len(mapped) == 1:
+            target = ord(mapped)
+            if utf8_length(target) <= utf8_length(code_point):
+                return target
+            return code_point
+    return code_point
+
+
+def main():
+    properties = []
+    property_index = {}
+    blocks = []
+    block_index = {}
+    stage1 = []
+
+    for start in range(0, CODE_POINTS, BLOCK_SIZE):
+        block = []
+        for code_point in range(start, start + BLOCK_SIZE):
+            cls = classify(code_point)
+            delta = fold(code_point) - code_point if cls == CLASS_KEPT else 0
+            key = (cls, delta)
+            if key not in property_index:
+                property_index[key] = len(properties)
+                properties.append(key)
+            block.append(property_index[key])
+        block = tuple(block)
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+
+    if len(properties) > 256 or len(blocks) > 256:
+        sys.exit("tables no longer fit 8-bit indices: %d properties, %d blocks" % (len(properties), len(blocks)))
+
+    out = sys.stdout
+    out.write("/*\n")
+    out.write(" * Most Frequent Words - Unicode class and case folding tables\n")
+    out.write(" * Copyright (c) 2025 ahmed khaled\n")
+    out.write(" * Licensed under the MIT License - see LICENSE file for details\n")
+    out.write(" *\n")
+    out.write(" * Generated by tools/unicodeTablesGen.py from Unicode %s, do not edit.\n" % unicodedata.unidata_version)
+    out.write(" * %d properties, %d distinct blocks of %d code points, %d bytes in all.\n"
+              % (len(properties), len(blocks), BLOCK_SIZE,
+                 len(properties) * 8 + len(blocks) * BLOCK_SIZE + len(stage1)))
+    out.write(" */\n\n")
+    out.write("#include <stdint.h>\n\n")
+    out.write("#include \"unicodeTables.h\"\n\n")
+    out.write("// Fails to compile if the generator and the header disagree on the block size\n")
+    out.write("typedef char unicodeTables_blockShiftMatches[(UNICODETABLES_BLOCK_SHIFT == %d) ? 1 : -1];\n\n"
+              % BLOCK_SHIFT)
+
+    out.write("const unicodeTables_property unicodeTables_properties[%d] = {\n" % len(properties))
+    for cls, delta in properties:
+        out.write("    { %d, %s },\n" % (delta, CLASS_NAMES[cls]))
+    out.write("};\n\n")
+
+    out.write("const uint8_t unicodeTables_blockIndex[%d] = {\n" % len(stage1))
+    for row in range(0, len(stage1), 16):
+        out.write("    " + ", ".join("%3d" % value for value in stage1[row:row + 16]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("const uint8_t unicodeTables_blocks[%d][%d] = {\n" % (len(blocks), BLOCK_SIZE))
+    for block in blocks:
+        out.write("    {\n")
+        for row in range(0, BLOCK_SIZE, 16):
+            out.write("        " + ", ".join("%3d" % value for value in block[row:row + 16]) + ",\n")
+        out.write("    },\n")
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()